@@ -0,0 +1,31 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "AStar.hpp"
+#include "ShortestPath.hpp"
+
+namespace ariel {
+
+    /**
+     * Finds the shortest path between two vertices with A* and the ALT heuristic.
+     * @param g The graph in which to find the shortest path, must not contain negative edges.
+     * @param source The source vertex.
+     * @param dest The destination vertex.
+     * @param landmarks Landmark tables built for g.
+     * @return A string describing the shortest path, or a message if no path exists.
+     * @throws std::invalid_argument if the input is invalid or the landmarks belong to another graph.
+     */
+    std::string AStar::Execute(const Graph &g, size_t source, size_t dest, const Landmarks &landmarks) {
+        if (g.isEmpty() || source >= g.V() || dest >= g.V())
+            throw std::invalid_argument("Invalid input for finding shortest path");
+        if (g.getEdgeNegativity() == EdgeNegativity::NEGATIVE)
+            throw std::invalid_argument("A* requires a graph without negative edges");
+        if (landmarks.V() != g.V())
+            throw std::invalid_argument("Landmarks were built for a different graph");
+
+        std::vector<size_t> path = search(g, source, dest, LandmarkHeuristic(landmarks, dest));
+        if (path.empty())
+            return "There is no path from " + std::to_string(source) + " to " + std::to_string(dest);
+
+        return ShortestPath::constructPath(path, source, dest);
+    }
+}
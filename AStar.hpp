@@ -0,0 +1,97 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef A_STAR_HPP
+#define A_STAR_HPP
+
+#include "Graph.hpp"
+#include "Landmarks.hpp"
+#include "PriorityQueues.hpp"
+#include "Workspace.hpp"
+#include <string>
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+namespace ariel {
+    class AStar {
+    public:
+        // shortest path from source to dest guided by the ALT bounds of prebuilt landmarks
+        static std::string Execute(const Graph &g, size_t source, size_t dest, const Landmarks &landmarks);
+
+        // A* with a user heuristic, heuristic(v) must never overestimate the distance from v to dest (admissible),
+        // a consistent one also expands every vertex at most once. returns the vertices of the path, empty if
+        // there is no path. the distances, parents and queue come from workspace, the calling thread's one by default
+        template <typename Heuristic>
+        static std::vector<size_t> search(const Graph &g, size_t source, size_t dest, Heuristic heuristic,
+                                          Workspace &workspace = Workspace::local());
+
+    private:
+        // ALT heuristic of a fixed target
+        class LandmarkHeuristic {
+        public:
+            LandmarkHeuristic(const Landmarks &landmarks, size_t target) : landmarks(landmarks), target(target) {}
+            int operator()(size_t v) const { return landmarks.lowerBound(v, target); }
+
+        private:
+            const Landmarks &landmarks;
+            size_t target;
+        };
+    };
+
+    /**
+     * A* search: Dijkstra's algorithm ordered by distance + heuristic, so vertices in the direction of dest
+     * are expanded first. an admissible heuristic that is not consistent can find a shorter path to a vertex
+     * after it was expanded, then the vertex is queued again, so the path is still a shortest one. with a
+     * consistent heuristic (like ALT) that never happens and every vertex is expanded at most once.
+     * @param g The graph, must not contain negative edges.
+     * @param source The source vertex.
+     * @param dest The destination vertex.
+     * @param heuristic Callable int(size_t v), a lower bound on the distance from v to dest.
+     * @param workspace Scratch storage, only the vertices the search reaches are touched.
+     * @return The vertices of a shortest path from source to dest, empty if there is no path.
+     */
+    template <typename Heuristic>
+    std::vector<size_t> AStar::search(const Graph &g, size_t source, size_t dest, Heuristic heuristic,
+                                      Workspace &workspace) {
+        const size_t NO_PARENT = std::numeric_limits<size_t>::max();
+        StampedArray<int> &dist = workspace.dist;
+        StampedArray<size_t> &parents = workspace.predecessors;
+        IndexedDaryHeap<4> &queue = workspace.heap;
+        dist.reset(g.V(), std::numeric_limits<int>::max());
+        parents.reset(g.V(), NO_PARENT);
+        queue.reset(g.V(), g.getMaxWeight());
+
+        dist[source] = 0;
+        queue.push(source, heuristic(source));
+
+        while (!queue.empty()) {
+            // dest leaves the queue with the smallest estimate, which no other path can beat
+            size_t u = queue.pop().second;
+            if (u == dest)
+                break;
+
+            // an expanded vertex whose distance still improves is reopened
+            int dist_u = dist[u];
+            g.forEachNeighbor(u, [&](size_t v, int weight_uv) {
+                if (dist[v] > dist_u + weight_uv) {
+                    dist[v] = dist_u + weight_uv;
+                    parents[v] = u;
+                    queue.push(v, dist[v] + heuristic(v));
+                }
+            });
+        }
+
+        // a vertex has no path to itself
+        if (parents[dest] == NO_PARENT)
+            return {};
+
+        std::vector<size_t> path;
+        for (size_t v = dest; v != source; v = parents[v])
+            path.push_back(v);
+        path.push_back(source);
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+}
+
+#endif // A_STAR_HPP
@@ -4,8 +4,32 @@
 
 namespace ariel {
 
-    std::string Algorithms::shortestPath(const Graph& g, size_t start, size_t end) {
-        return ShortestPath::Execute(g, start, end);
+    std::string Algorithms::shortestPath(const Graph& g, size_t start, size_t end, WeightedEngine engine) {
+        return ShortestPath::Execute(g, start, end, engine);
+    }
+
+    std::string Algorithms::shortestPath(const Graph& g, size_t start, size_t end, const Landmarks& landmarks) {
+        return AStar::Execute(g, start, end, landmarks);
+    }
+
+    std::vector<std::vector<size_t>> Algorithms::kShortestPaths(const Graph& g, size_t start, size_t end, size_t k) {
+        return KShortestPaths::Execute(g, start, end, k);
+    }
+
+    std::vector<std::string> Algorithms::shortestPaths(const Graph& g, const std::vector<std::pair<size_t, size_t>>& queries) {
+        return ShortestPath::ExecuteBatch(g, queries);
+    }
+
+    std::vector<std::vector<int>> Algorithms::bfsDistances(const Graph& g, const std::vector<size_t>& sources) {
+        return ShortestPath::bfsDistances(g, sources);
+    }
+
+    std::vector<std::pair<size_t, int>> Algorithms::verticesWithinHops(const Graph& g, size_t start, size_t hops) {
+        return LocalSearch::withinHops(g, start, hops);
+    }
+
+    std::vector<std::pair<size_t, int>> Algorithms::verticesWithinDistance(const Graph& g, size_t start, int limit) {
+        return LocalSearch::withinDistance(g, start, limit);
     }
 
     bool Algorithms::isConnected(const Graph& g) {
@@ -23,9 +47,78 @@ namespace ariel {
     }
 
 
+    std::string Algorithms::minimumMeanCycle(const Graph &g) {
+        return MinimumMeanCycle::Execute(g);
+    }
+
+    std::vector<std::vector<size_t>> Algorithms::simpleCycles(const Graph &g, size_t limit, bool negativeOnly) {
+        std::vector<std::vector<size_t>> cycles;
+        if (limit == 0)
+            return cycles;
+        SimpleCycles::Visitor collect = [&](const std::vector<size_t> &cycle) {
+            cycles.push_back(cycle);
+            return cycles.size() < limit;
+        };
+        if (negativeOnly)
+            SimpleCycles::enumerateNegative(g, collect);
+        else
+            SimpleCycles::enumerate(g, collect);
+        return cycles;
+    }
+
     std::string Algorithms::isBipartite(const Graph &g) {
         return IsBipartite::Execute(g);
     }
 
+    std::string Algorithms::oddCycle(const Graph &g) {
+        return IncrementalBipartite(g).toString();
+    }
+
+    size_t Algorithms::countTriangles(const Graph &g) {
+        return TriangleCount::Execute(g);
+    }
+
+    std::vector<double> Algorithms::clusteringCoefficients(const Graph &g) {
+        return TriangleCount::clusteringCoefficients(g);
+    }
+
+    std::vector<size_t> Algorithms::coreNumbers(const Graph &g) {
+        return KCore::Execute(g);
+    }
+
+    std::vector<size_t> Algorithms::degeneracyOrdering(const Graph &g) {
+        return KCore::degeneracyOrdering(g);
+    }
+
+    std::vector<double> Algorithms::pageRank(const Graph &g) {
+        return PageRank::Execute<double>(g);
+    }
+
+    std::vector<double> Algorithms::personalizedPageRank(const Graph &g, const std::vector<size_t> &seeds) {
+        return PageRank::personalized<double>(g, seeds);
+    }
+
+    std::vector<double> Algorithms::betweenness(const Graph &g, size_t pivots) {
+        return pivots == 0 ? Betweenness::Execute(g) : Betweenness::sampled(g, pivots);
+    }
+
+    std::string Algorithms::maximumMatching(const Graph &g) {
+        return BipartiteMatching::toString(BipartiteMatching::Execute(g));
+    }
+
+    std::string Algorithms::minimumWeightAssignment(const Graph &g) {
+        return BipartiteMatching::toString(BipartiteMatching::assignment(g));
+    }
+
+    std::string Algorithms::minimumSpanningTree(const Graph &g, MstEngine engine) {
+        return MinimumSpanningTree::toString(MinimumSpanningTree::Execute(g, engine));
+    }
+
+    std::string Algorithms::maxFlow(const Graph &g, size_t source, size_t sink) {
+        MaxFlow flow(g);
+        flow.Execute(source, sink);
+        return flow.toString();
+    }
+
 
 }
\ No newline at end of file
@@ -9,16 +9,56 @@
 #include "IsBipartite.hpp"
 #include "IsConnected.hpp"
 #include "DetectNegativeCycle.hpp"
+#include "AStar.hpp"
+#include "ContractionHierarchy.hpp"
+#include "LocalSearch.hpp"
+#include "KShortestPaths.hpp"
+#include "MinimumMeanCycle.hpp"
+#include "SimpleCycles.hpp"
+#include "MinimumSpanningTree.hpp"
+#include "MaxFlow.hpp"
+#include "BipartiteMatching.hpp"
+#include "IncrementalBipartite.hpp"
+#include "TriangleCount.hpp"
+#include "PageRank.hpp"
+#include "Betweenness.hpp"
+#include "KCore.hpp"
 #include <string>
+#include <vector>
 
 namespace ariel {
     class Algorithms {
     public:
         static bool isConnected(const Graph& g);
-        static std::string shortestPath(const Graph& g, size_t start, size_t end);
+        static std::string shortestPath(const Graph& g, size_t start, size_t end,
+                                        WeightedEngine engine = WeightedEngine::AUTO);
+        static std::string shortestPath(const Graph& g, size_t start, size_t end, const Landmarks& landmarks);
+        static std::vector<std::vector<size_t>> kShortestPaths(const Graph& g, size_t start, size_t end, size_t k);
+        static std::vector<std::string> shortestPaths(const Graph& g, const std::vector<std::pair<size_t, size_t>>& queries);
+        static std::vector<std::vector<int>> bfsDistances(const Graph& g, const std::vector<size_t>& sources);
+        static std::vector<std::pair<size_t, int>> verticesWithinHops(const Graph& g, size_t start, size_t hops);
+        static std::vector<std::pair<size_t, int>> verticesWithinDistance(const Graph& g, size_t start, int limit);
         static std::string isContainsCycle(const Graph& g);
         static std::string negativeCycle(const Graph& g);
+        static std::string minimumMeanCycle(const Graph& g);
+        // at most limit simple cycles, only the negative ones when negativeOnly is set
+        static std::vector<std::vector<size_t>> simpleCycles(const Graph& g, size_t limit, bool negativeOnly = false);
         static std::string isBipartite(const Graph& g);
+        // an odd cycle when the graph is not bipartite
+        static std::string oddCycle(const Graph& g);
+        static size_t countTriangles(const Graph& g);
+        static std::vector<double> clusteringCoefficients(const Graph& g);
+        static std::vector<size_t> coreNumbers(const Graph& g);
+        static std::vector<size_t> degeneracyOrdering(const Graph& g);
+        static std::vector<double> pageRank(const Graph& g);
+        static std::vector<double> personalizedPageRank(const Graph& g, const std::vector<size_t>& seeds);
+        // exact when pivots is 0, otherwise estimated from that many sampled sources
+        static std::vector<double> betweenness(const Graph& g, size_t pivots = 0);
+        static std::string maximumMatching(const Graph& g);
+        // maximum matching of minimum total weight
+        static std::string minimumWeightAssignment(const Graph& g);
+        static std::string minimumSpanningTree(const Graph& g, MstEngine engine = MstEngine::AUTO);
+        static std::string maxFlow(const Graph& g, size_t source, size_t sink);
 
     };
 }
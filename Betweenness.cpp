@@ -0,0 +1,123 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "Betweenness.hpp"
+#include "ShortestPath.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+namespace ariel {
+
+    std::vector<double> Betweenness::Execute(const Graph &g, size_t threads) {
+        std::vector<size_t> sources(g.V());
+        std::iota(sources.begin(), sources.end(), size_t(0));
+        return accumulate(g, sources, threads);
+    }
+
+    /**
+     * Approximate betweenness from a uniform sample of distinct sources, every source's dependencies are an
+     * unbiased estimate of the average over all of them. the same seed gives the same sample.
+     * @param g The graph.
+     * @param pivots Number of sources to traverse from.
+     * @param seed Seed of the sample.
+     * @param threads Number of worker threads.
+     * @return The estimated score of every vertex.
+     * @throws std::invalid_argument if pivots is 0 on a non-empty graph or the graph has negative edges.
+     */
+    std::vector<double> Betweenness::sampled(const Graph &g, size_t pivots, unsigned seed, size_t threads) {
+        size_t n = g.V();
+        if (pivots == 0 && n > 0)
+            throw std::invalid_argument("Sampled betweenness requires at least one pivot");
+        if (pivots >= n)
+            return Execute(g, threads);
+
+        // the first pivots entries of a partial Fisher-Yates shuffle
+        std::vector<size_t> sources(n);
+        std::iota(sources.begin(), sources.end(), size_t(0));
+        std::mt19937 random(seed);
+        for (size_t i = 0; i < pivots; ++i) {
+            std::uniform_int_distribution<size_t> pick(i, n - 1);
+            std::swap(sources[i], sources[pick(random)]);
+        }
+        sources.resize(pivots);
+
+        std::vector<double> centrality = accumulate(g, sources, threads);
+        double scale = static_cast<double>(n) / static_cast<double>(pivots);
+        for (double &score : centrality)
+            score *= scale;
+        return centrality;
+    }
+
+    /**
+     * Runs the sources in parallel, each worker on its own workspace and its own score array, and sums the
+     * arrays at the end so the workers need no atomics.
+     * @throws std::invalid_argument if the graph has negative edges.
+     */
+    std::vector<double> Betweenness::accumulate(const Graph &g, const std::vector<size_t> &sources, size_t threads) {
+        if (g.getEdgeNegativity() == EdgeNegativity::NEGATIVE)
+            throw std::invalid_argument("Betweenness requires a graph without negative edges");
+        size_t n = g.V();
+        if (n <= 1 || sources.empty())
+            return std::vector<double>(n, 0.0);
+        threads = std::max<size_t>(1, std::min(threads, sources.size()));
+
+        std::vector<std::vector<double>> partial(threads, std::vector<double>(n, 0.0));
+        std::vector<std::vector<double>> sigma(threads, std::vector<double>(n)), delta(threads, std::vector<double>(n));
+        Parallel::forEach(0, sources.size(), threads, [&](size_t thread, size_t i) {
+            singleSource(g, sources[i], Workspace::local(), sigma[thread], delta[thread], partial[thread]);
+        }, 1);
+
+        std::vector<double> centrality(n, 0.0);
+        for (const std::vector<double> &scores : partial) {
+            for (size_t v = 0; v < n; ++v)
+                centrality[v] += scores[v];
+        }
+        // an undirected pair was counted from both of its ends
+        if (g.getGraphType() == GraphType::UNDIRECTED) {
+            for (double &score : centrality)
+                score /= 2;
+        }
+        return centrality;
+    }
+
+    /**
+     * One source of Brandes' algorithm. the edges u -> v with dist[u] + w(u, v) == dist[v] form the DAG of
+     * shortest paths from the source: sigma counts the paths to every vertex in increasing distance, and the
+     * dependency delta[u] = sum of sigma[u] / sigma[v] * (1 + delta[v]) over the DAG successors v is summed in
+     * decreasing distance. the traversal leaves the reached vertices by distance (Dijkstra in the order it settles
+     * them), so only those are touched and a source in a small component is cheap.
+     */
+    void Betweenness::singleSource(const Graph &g, size_t source, Workspace &workspace, std::vector<double> &sigma,
+                                   std::vector<double> &delta, std::vector<double> &centrality) {
+        ShortestPath::distances(g, source, workspace);
+        const StampedArray<int> &dist = workspace.dist;
+        const int INF = std::numeric_limits<int>::max();
+
+        // BFS and Dijkstra both leave the reached vertices by increasing distance
+        const std::vector<size_t> &order = workspace.queue;
+
+        for (size_t v : order) {
+            sigma[v] = 0;
+            delta[v] = 0;
+        }
+        sigma[source] = 1;
+        for (size_t u : order) {
+            g.forEachNeighbor(u, [&](size_t v, int weight) {
+                if (dist[v] != INF && dist[v] == dist[u] + weight)
+                    sigma[v] += sigma[u];
+            });
+        }
+
+        for (size_t i = order.size(); i-- > 0;) {
+            size_t u = order[i];
+            g.forEachNeighbor(u, [&](size_t v, int weight) {
+                if (dist[v] != INF && dist[v] == dist[u] + weight)
+                    delta[u] += sigma[u] / sigma[v] * (1 + delta[v]);
+            });
+            if (u != source)
+                centrality[u] += delta[u];
+        }
+    }
+}
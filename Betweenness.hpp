@@ -0,0 +1,37 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef BETWEENNESS_HPP
+#define BETWEENNESS_HPP
+
+#include "Graph.hpp"
+#include "Parallel.hpp"
+#include "Workspace.hpp"
+#include <vector>
+
+namespace ariel {
+    /**
+     * Betweenness centrality by Brandes' algorithm: the number of shortest paths between other pairs of vertices
+     * that pass through every vertex, a path shared by k shortest paths counting 1 / k. unweighted graphs are
+     * traversed by BFS and weighted ones by Dijkstra, both from ShortestPath. the scores are not normalized, an
+     * undirected graph counts every unordered pair once. negative edges are not supported.
+     */
+    class Betweenness {
+    public:
+        // exact scores, one traversal from every vertex
+        static std::vector<double> Execute(const Graph &g, size_t threads = Parallel::numThreads());
+
+        // estimated scores from the given number of random sources scaled by V / pivots, exact when pivots >= V
+        static std::vector<double> sampled(const Graph &g, size_t pivots, unsigned seed = 1,
+                                           size_t threads = Parallel::numThreads());
+
+    private:
+        // the scores summed over the given sources, the threads each keep their own sums
+        static std::vector<double> accumulate(const Graph &g, const std::vector<size_t> &sources, size_t threads);
+
+        // adds the dependencies of every vertex on source to centrality, sigma and delta are scratch of size V
+        static void singleSource(const Graph &g, size_t source, Workspace &workspace, std::vector<double> &sigma,
+                                 std::vector<double> &delta, std::vector<double> &centrality);
+    };
+}
+
+#endif // BETWEENNESS_HPP
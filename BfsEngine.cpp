@@ -0,0 +1,318 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "BfsEngine.hpp"
+#include <algorithm>
+
+namespace ariel {
+
+    const size_t BfsEngine::NO_VERTEX;
+
+    /**
+     * Level-synchronous direction-optimizing BFS (Beamer et al.).
+     * small frontiers are expanded top-down (scan the rows of the frontier vertices),
+     * large frontiers bottom-up (every unexplored vertex scans its column for a frontier parent and stops
+     * at the first one found), which saves most of the edge checks on low-diameter graphs.
+     * the adjacency matrix gives no cheap edge counts, so the switch uses vertex counts of the frontier
+     * and of the unexplored set instead of Beamer's edge counts.
+     * each level is split between the worker threads, vertices are claimed in an atomic visited bitmap
+     * and every thread collects the next frontier in its own buffer.
+     * @param g The graph to traverse, edge weights are ignored.
+     * @param source The vertex to start from.
+     * @param dest Stop once this vertex was reached, NO_VERTEX to explore everything reachable.
+     * @param threads Number of worker threads, 1 runs the traversal in the calling thread.
+     * @return dist[v] is the number of edges on a shortest path from source to v, INT_MAX if unreachable.
+     */
+    std::vector<int> BfsEngine::distances(const Graph &g, size_t source, size_t dest, size_t threads) {
+        size_t n = g.V();
+        threads = std::max<size_t>(1, threads);
+        std::vector<int> dist(n, std::numeric_limits<int>::max());
+        AtomicBitmap visited((n + Bitmap::WORD_BITS - 1) / Bitmap::WORD_BITS);
+        clearBits(visited);
+
+        dist[source] = 0;
+        claim(visited, source);
+        size_t unexplored = n - 1;
+        traverse(g, source, dest, threads, visited, dist, unexplored);
+        return dist;
+    }
+
+    /**
+     * Bfs levels of every component with the parallel traversal, for the bipartite coloring.
+     * the components are traversed one after the other from their smallest vertex, all of them on one visited
+     * bitmap and on workspace.dist, so a graph of many small components costs O(V + E) instead of a V sized
+     * allocation and scan per component.
+     * @param g The graph to traverse, edge weights are ignored.
+     * @param threads Number of worker threads.
+     * @param workspace Receives the levels in dist.
+     */
+    void BfsEngine::componentLevels(const Graph &g, size_t threads, Workspace &workspace) {
+        size_t n = g.V();
+        threads = std::max<size_t>(1, threads);
+        StampedArray<int> &dist = workspace.dist;
+        dist.reset(n, std::numeric_limits<int>::max());
+        AtomicBitmap visited((n + Bitmap::WORD_BITS - 1) / Bitmap::WORD_BITS);
+        clearBits(visited);
+
+        size_t unexplored = n;
+        for (size_t start = 0; start < n; ++start) {
+            if (isVisited(visited, start))
+                continue;
+            claim(visited, start);
+            dist[start] = 0;
+            unexplored--;
+            // an isolated vertex needs no traversal
+            if (!g.neighbors(start).empty())
+                traverse(g, start, NO_VERTEX, threads, visited, dist, unexplored);
+        }
+    }
+
+    /**
+     * Level-synchronous direction-optimizing BFS (Beamer et al.).
+     * small frontiers are expanded top-down (scan the rows of the frontier vertices),
+     * large frontiers bottom-up (every unexplored vertex scans its column for a frontier parent and stops
+     * at the first one found), which saves most of the edge checks on low-diameter graphs.
+     * the adjacency matrix gives no cheap edge counts, so the switch uses vertex counts of the frontier
+     * and of the unexplored set instead of Beamer's edge counts.
+     * each level is split between the worker threads, vertices are claimed in an atomic visited bitmap
+     * and every thread collects the next frontier in its own buffer.
+     * @param g The graph to traverse, edge weights are ignored.
+     * @param source The vertex to start from.
+     * @param dest Stop once this vertex was reached, NO_VERTEX to explore everything reachable.
+     * @param threads Number of worker threads, 1 runs the traversal in the calling thread.
+     * @param visited The claimed vertices, the traversal only enters vertices that are not claimed yet.
+     * @param dist Receives dist[v], the number of edges on a shortest path from source to v, for every vertex reached.
+     * @param unexplored The number of vertices not claimed yet.
+     */
+    template <typename DistArray>
+    void BfsEngine::traverse(const Graph &g, size_t source, size_t dest, size_t threads, AtomicBitmap &visited,
+                             DistArray &dist, size_t &unexplored) {
+        size_t n = g.V();
+        // the frontier is kept as a list for top-down steps and as a bitmap for bottom-up steps,
+        // the bitmap is only allocated once a bottom-up step needs it
+        std::vector<size_t> frontier(1, source);
+        Bitmap frontierBits;
+        std::vector<std::vector<size_t>> next(threads);
+
+        bool bottomUp = false;
+        int depth = 0;
+
+        while (!frontier.empty()) {
+            // Check if the destination vertex is reached, its distance is final
+            if (dest != NO_VERTEX && dist[dest] != std::numeric_limits<int>::max())
+                break;
+
+            // Beamer's heuristic on vertex counts
+            if (!bottomUp && frontier.size() > unexplored / ALPHA)
+                bottomUp = true;
+            else if (bottomUp && frontier.size() < n / BETA)
+                bottomUp = false;
+
+            for (std::vector<size_t> &buffer : next)
+                buffer.clear();
+
+            if (bottomUp) {
+                if (frontierBits.size() != n)
+                    Bitmap(n).swap(frontierBits);
+                else
+                    frontierBits.clear();
+                for (size_t u : frontier)
+                    frontierBits.set(u);
+                bottomUpStep(g, frontierBits, visited, dist, depth, next, threads);
+            } else {
+                topDownStep(g, frontier, visited, dist, depth, next, threads);
+            }
+
+            // gather the per-thread buffers into the next frontier
+            frontier.clear();
+            for (const std::vector<size_t> &buffer : next)
+                frontier.insert(frontier.end(), buffer.begin(), buffer.end());
+
+            unexplored -= frontier.size();
+            depth++;
+        }
+    }
+
+    /**
+     * The direction-optimizing BFS of a single thread on workspace storage.
+     * the queue holds every level in turn, so the frontier is the range of the queue added by the last level,
+     * and a vertex is in the frontier exactly when its distance is the current depth, which is what the
+     * bottom-up step tests instead of a frontier bitmap. directed graphs stay top-down, without in-neighbour
+     * lists every parent lookup would scan a column of the matrix.
+     * @param g The graph to traverse, edge weights are ignored.
+     * @param source The vertex to start from.
+     * @param dest Stop once this vertex was reached, NO_VERTEX to explore everything reachable.
+     * @param workspace Receives the distances in dist and the reached vertices in queue.
+     */
+    void BfsEngine::distances(const Graph &g, size_t source, size_t dest, Workspace &workspace) {
+        const int INF = std::numeric_limits<int>::max();
+        size_t n = g.V();
+        bool undirected = g.getGraphType() == GraphType::UNDIRECTED;
+        StampedArray<int> &dist = workspace.dist;
+        dist.reset(n, INF);
+        std::vector<size_t> &queue = workspace.queue;
+        queue.assign(1, source);
+        dist[source] = 0;
+
+        size_t levelStart = 0, unexplored = n - 1;
+        bool bottomUp = false;
+        for (int depth = 0; levelStart < queue.size(); ++depth) {
+            // Check if the destination vertex is reached, its distance is final
+            if (dest != NO_VERTEX && dist[dest] != INF)
+                break;
+
+            size_t levelEnd = queue.size(), frontier = levelEnd - levelStart;
+            // Beamer's heuristic on vertex counts
+            if (undirected && !bottomUp && frontier > unexplored / ALPHA)
+                bottomUp = true;
+            else if (bottomUp && frontier < n / BETA)
+                bottomUp = false;
+
+            if (bottomUp) {
+                for (size_t v = 0; v < n; ++v) {
+                    if (dist[v] != INF)
+                        continue;
+                    for (size_t u : g.neighbors(v)) {
+                        if (dist[u] == depth) {
+                            dist[v] = depth + 1;
+                            queue.push_back(v);
+                            break;
+                        }
+                    }
+                }
+            } else {
+                for (size_t i = levelStart; i < levelEnd; ++i) {
+                    for (size_t v : g.neighbors(queue[i])) {
+                        if (dist[v] == INF) {
+                            dist[v] = depth + 1;
+                            queue.push_back(v);
+                        }
+                    }
+                }
+            }
+
+            unexplored -= queue.size() - levelEnd;
+            levelStart = levelEnd;
+        }
+    }
+
+    /**
+     * Multi-source BFS (MS-BFS): the traversals of up to 64 sources share one pass over the graph.
+     * every vertex keeps a word with one bit per source, so expanding a vertex once serves
+     * all the sources whose frontier currently contains it, and only its adjacency list is scanned, so a batch
+     * costs O(depth * (V + E)).
+     * @param g The graph to traverse, edge weights are ignored.
+     * @param sources The vertices to start from, may contain duplicates.
+     * @return rows[i][v] is the number of edges from sources[i] to v, INT_MAX if unreachable.
+     */
+    std::vector<std::vector<int>> BfsEngine::multiSourceDistances(const Graph &g, const std::vector<size_t> &sources) {
+        std::vector<std::vector<int>> rows(sources.size(), std::vector<int>(g.V(), std::numeric_limits<int>::max()));
+        for (size_t first = 0; first < sources.size(); first += Bitmap::WORD_BITS)
+            multiSourceBatch(g, sources, first, rows);
+        return rows;
+    }
+
+    void BfsEngine::multiSourceBatch(const Graph &g, const std::vector<size_t> &sources, size_t first,
+                                     std::vector<std::vector<int>> &rows) {
+        size_t n = g.V();
+        size_t batch = std::min(size_t(Bitmap::WORD_BITS), sources.size() - first);
+
+        // bit i of a word stands for the traversal from sources[first + i]
+        std::vector<uint64_t> seen(n, 0), visit(n, 0), visitNext(n, 0);
+        for (size_t i = 0; i < batch; ++i) {
+            size_t s = sources[first + i];
+            seen[s] |= uint64_t(1) << i;
+            visit[s] |= uint64_t(1) << i;
+            rows[first + i][s] = 0;
+        }
+
+        bool active = true;
+        for (int depth = 1; active; ++depth) {
+            active = false;
+            for (size_t u = 0; u < n; ++u) {
+                if (visit[u] == 0)
+                    continue;
+                for (size_t v : g.neighbors(u)) {
+                    // the traversals that reach v for the first time through u
+                    uint64_t reached = visit[u] & ~seen[v];
+                    if (reached == 0)
+                        continue;
+                    visitNext[v] |= reached;
+                    seen[v] |= reached;
+                    active = true;
+                    while (reached != 0) {
+                        size_t bit = static_cast<size_t>(__builtin_ctzll(reached));
+                        rows[first + bit][v] = depth;
+                        reached &= reached - 1;
+                    }
+                }
+            }
+            visit.swap(visitNext);
+            std::fill(visitNext.begin(), visitNext.end(), 0);
+        }
+    }
+
+    // expand the rows of the frontier vertices into the per-thread next buffers
+    template <typename DistArray>
+    void BfsEngine::topDownStep(const Graph &g, const std::vector<size_t> &frontier, AtomicBitmap &visited,
+                                DistArray &dist, int depth, std::vector<std::vector<size_t>> &next, size_t threads) {
+        Parallel::forEach(0, frontier.size(), threads, [&](size_t thread, size_t i) {
+            size_t u = frontier[i];
+            for (size_t v : g.neighbors(u)) {
+                // only the thread that claims v records it
+                if (!isVisited(visited, v) && claim(visited, v)) {
+                    dist[v] = depth + 1;
+                    next[thread].push_back(v);
+                }
+            }
+        }, 1);
+    }
+
+    // every unexplored vertex looks for a parent in the frontier
+    template <typename DistArray>
+    void BfsEngine::bottomUpStep(const Graph &g, const Bitmap &frontier, AtomicBitmap &visited, DistArray &dist,
+                                 int depth, std::vector<std::vector<size_t>> &next, size_t threads) {
+        size_t n = g.V();
+        bool undirected = g.getGraphType() == GraphType::UNDIRECTED;
+        Parallel::forEach(0, n, threads, [&](size_t thread, size_t v) {
+            if (isVisited(visited, v))
+                return;
+            auto adopt = [&]() {
+                claim(visited, v);
+                dist[v] = depth + 1;
+                next[thread].push_back(v);
+            };
+            // parents are taken from the frontier bitmap only, so vertices found in this level are never used
+            // in an undirected graph the parents are the neighbours of v, a directed one needs the column of v
+            if (undirected) {
+                for (size_t u : g.neighbors(v)) {
+                    if (frontier.test(u)) {
+                        adopt();
+                        return;
+                    }
+                }
+                return;
+            }
+            for (size_t u = 0; u < n; ++u) {
+                if (frontier.test(u) && g.getEdgeWeight(u, v) != 0) {
+                    adopt();
+                    return;
+                }
+            }
+        });
+    }
+
+    void BfsEngine::clearBits(AtomicBitmap &bits) {
+        for (std::atomic<uint64_t> &word : bits)
+            word.store(0);
+    }
+
+    bool BfsEngine::isVisited(const AtomicBitmap &visited, size_t v) {
+        return (visited[v / Bitmap::WORD_BITS].load(std::memory_order_relaxed) >> (v % Bitmap::WORD_BITS)) & 1U;
+    }
+
+    // sets the bit of v, returns true if this call was the one that set it
+    bool BfsEngine::claim(AtomicBitmap &visited, size_t v) {
+        uint64_t mask = uint64_t(1) << (v % Bitmap::WORD_BITS);
+        return (visited[v / Bitmap::WORD_BITS].fetch_or(mask) & mask) == 0;
+    }
+}
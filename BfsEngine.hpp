@@ -0,0 +1,70 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef BFS_ENGINE_HPP
+#define BFS_ENGINE_HPP
+
+#include "Graph.hpp"
+#include "Bitmap.hpp"
+#include "Parallel.hpp"
+#include "Workspace.hpp"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <limits>
+
+namespace ariel {
+    class BfsEngine {
+    public:
+        // marks "no destination" for the traversal, i.e. explore everything reachable
+        static const size_t NO_VERTEX = std::numeric_limits<size_t>::max();
+
+        // number of edges from source to every vertex, INT_MAX for unreachable vertices
+        static std::vector<int> distances(const Graph &g, size_t source, size_t dest = NO_VERTEX, size_t threads = 1);
+
+        // the same traversal on the calling thread into workspace.dist, INT_MAX for unreachable vertices, with
+        // workspace.queue holding the reached vertices by distance. the stamped distances are the visited marks,
+        // so nothing of size V is cleared or allocated and a query that stops early pays only for what it visited
+        static void distances(const Graph &g, size_t source, size_t dest, Workspace &workspace);
+
+        // the parallel traversal repeated from every vertex not reached yet, in increasing order, into workspace.dist:
+        // in an undirected graph the level of every vertex in the bfs tree of the smallest vertex of its component.
+        // the visited bitmap is shared by all the traversals, so each one only touches the vertices it reaches
+        static void componentLevels(const Graph &g, size_t threads, Workspace &workspace);
+
+        // distances from many sources at once, row i holds the distances from sources[i]
+        static std::vector<std::vector<int>> multiSourceDistances(const Graph &g, const std::vector<size_t> &sources);
+
+    private:
+        // switch to bottom-up once the frontier holds more than 1/ALPHA of the unexplored vertices
+        static const size_t ALPHA = 14;
+        // switch back to top-down once the frontier holds less than 1/BETA of all vertices
+        static const size_t BETA = 24;
+
+        // runs one bit-parallel traversal for up to 64 sources starting at sources[first]
+        static void multiSourceBatch(const Graph &g, const std::vector<size_t> &sources, size_t first,
+                                     std::vector<std::vector<int>> &rows);
+
+        typedef std::vector<std::atomic<uint64_t>> AtomicBitmap;
+
+        static void clearBits(AtomicBitmap &bits);
+
+        // one traversal from source, which the caller has claimed in visited and given distance 0, over the vertices
+        // not claimed yet. unexplored counts the vertices not claimed and is kept up to date.
+        // dist is a std::vector<int> or a StampedArray<int>, each entry is written by the thread that claims it
+        template <typename DistArray>
+        static void traverse(const Graph &g, size_t source, size_t dest, size_t threads, AtomicBitmap &visited,
+                             DistArray &dist, size_t &unexplored);
+
+        template <typename DistArray>
+        static void topDownStep(const Graph &g, const std::vector<size_t> &frontier, AtomicBitmap &visited,
+                                DistArray &dist, int depth, std::vector<std::vector<size_t>> &next, size_t threads);
+        template <typename DistArray>
+        static void bottomUpStep(const Graph &g, const Bitmap &frontier, AtomicBitmap &visited, DistArray &dist,
+                                 int depth, std::vector<std::vector<size_t>> &next, size_t threads);
+
+        static bool isVisited(const AtomicBitmap &visited, size_t v);
+        static bool claim(AtomicBitmap &visited, size_t v);
+    };
+}
+
+#endif // BFS_ENGINE_HPP
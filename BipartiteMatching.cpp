@@ -0,0 +1,325 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "BipartiteMatching.hpp"
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+namespace ariel {
+
+    const size_t BipartiteMatching::NO_VERTEX;
+
+    /**
+     * Maximum cardinality matching by Hopcroft-Karp.
+     * a greedy pass matches what it can, then every phase finds the shortest augmenting paths with one BFS from all
+     * the free left vertices and augments a maximal set of vertex disjoint ones along the BFS layers.
+     * there are O(sqrt(V)) phases of O(E) each.
+     * @param g The undirected bipartite graph.
+     * @param workspace Scratch buffers, the partition is read from workspace.colors.
+     * @return The matched (left, right) pairs sorted by the left vertex.
+     * @throws std::invalid_argument if the graph is directed or not bipartite.
+     */
+    BipartiteMatching::Matching BipartiteMatching::Execute(const Graph &g, Workspace &workspace) {
+        checkInput(g, workspace);
+        const StampedArray<int> &colors = workspace.colors;
+        size_t n = g.V();
+        std::vector<size_t> mate(n, NO_VERTEX);
+
+        // greedy start, usually most of the matching
+        for (size_t u = 0; u < n; ++u) {
+            if (colors[u] != 0)
+                continue;
+            for (size_t v : g.neighbors(u)) {
+                if (mate[v] == NO_VERTEX) {
+                    mate[u] = v;
+                    mate[v] = u;
+                    break;
+                }
+            }
+        }
+
+        std::vector<size_t> layer(n), next(n), stack;
+        size_t freeLayer = 0;
+        while (buildLayers(g, colors, mate, layer, workspace.queue, freeLayer)) {
+            for (size_t u = 0; u < n; ++u)
+                next[u] = 0;
+            for (size_t u = 0; u < n; ++u) {
+                if (colors[u] == 0 && mate[u] == NO_VERTEX)
+                    augment(g, mate, layer, next, stack, u, freeLayer);
+            }
+        }
+        return collect(mate, colors);
+    }
+
+    /**
+     * Minimum weight assignment by the Hungarian method, in its successive shortest paths form over the adjacency
+     * lists: every round runs Dijkstra from all the free left vertices on reduced costs and augments along the
+     * cheapest path to a free right vertex, then the potentials take the distances so the reduced costs stay
+     * non-negative. each matching found on the way is the cheapest of its size, so the result is a maximum
+     * matching of minimum total weight. the potentials start at the cheapest edge into every right vertex, which
+     * allows negative weights, and include a source and a sink joined to the free vertices so that paths that
+     * start and end at different free vertices compare on the same scale. negate the weights for a maximum
+     * weight assignment.
+     * @param g The undirected bipartite graph, the edge weights are the costs.
+     * @param workspace Scratch buffers, the partition is read from workspace.colors.
+     * @return The matched (left, right) pairs sorted by the left vertex.
+     * @throws std::invalid_argument if the graph is directed or not bipartite.
+     */
+    BipartiteMatching::Matching BipartiteMatching::assignment(const Graph &g, Workspace &workspace) {
+        checkInput(g, workspace);
+        const StampedArray<int> &colors = workspace.colors;
+        size_t n = g.V();
+        const long long INF = std::numeric_limits<long long>::max();
+        // vertex n is the sink every free right vertex reaches at no cost, the source sits at potential 0
+        size_t sinkVertex = n;
+
+        std::vector<size_t> mate(n, NO_VERTEX);
+        std::vector<long long> potential(n + 1, 0);
+        bool anyEdge = false;
+        for (size_t v = 0; v < n; ++v) {
+            if (colors[v] != 1 || g.neighbors(v).empty())
+                continue;
+            potential[v] = INF;
+            for (size_t u : g.neighbors(v))
+                potential[v] = std::min(potential[v], static_cast<long long>(g.getEdgeWeight(u, v)));
+            potential[sinkVertex] = anyEdge ? std::min(potential[sinkVertex], potential[v]) : potential[v];
+            anyEdge = true;
+        }
+
+        std::vector<long long> dist(n + 1);
+        std::vector<size_t> parent(n + 1);
+        std::priority_queue<std::pair<long long, size_t>, std::vector<std::pair<long long, size_t>>,
+                std::greater<std::pair<long long, size_t>>> queue;
+        while (true) {
+            for (size_t v = 0; v <= n; ++v) {
+                dist[v] = INF;
+                // the reduced cost of the source arc into a free left vertex
+                if (v < n && colors[v] == 0 && mate[v] == NO_VERTEX) {
+                    dist[v] = -potential[v];
+                    queue.emplace(dist[v], v);
+                }
+            }
+
+            // Dijkstra on the residual graph: left to right over unmatched edges, right to left over matched ones
+            while (!queue.empty()) {
+                std::pair<long long, size_t> top = queue.top();
+                queue.pop();
+                size_t u = top.second;
+                if (top.first != dist[u])
+                    continue;
+                if (u == sinkVertex)
+                    break;
+                if (colors[u] == 1) {
+                    // a free right vertex goes on to the sink, a matched one back over its tight matched edge
+                    size_t v = mate[u] == NO_VERTEX ? sinkVertex : mate[u];
+                    long long reduced = v == sinkVertex ? potential[u] - potential[sinkVertex] : 0;
+                    if (dist[u] + reduced < dist[v]) {
+                        dist[v] = dist[u] + reduced;
+                        parent[v] = u;
+                        queue.emplace(dist[v], v);
+                    }
+                    continue;
+                }
+                for (size_t v : g.neighbors(u)) {
+                    if (v == mate[u])
+                        continue;
+                    long long reduced = g.getEdgeWeight(u, v) + potential[u] - potential[v];
+                    if (dist[u] + reduced < dist[v]) {
+                        dist[v] = dist[u] + reduced;
+                        parent[v] = u;
+                        queue.emplace(dist[v], v);
+                    }
+                }
+            }
+            while (!queue.empty())
+                queue.pop();
+            if (dist[sinkVertex] == INF)
+                break;
+
+            // vertices beyond the sink are treated as being at its distance
+            long long limit = dist[sinkVertex];
+            for (size_t v = 0; v <= n; ++v)
+                potential[v] += std::min(dist[v], limit);
+
+            // flip the path, it ends at a free left vertex
+            size_t v = parent[sinkVertex];
+            while (true) {
+                size_t u = parent[v];
+                size_t previous = mate[u];
+                mate[u] = v;
+                mate[v] = u;
+                if (previous == NO_VERTEX)
+                    break;
+                v = previous;
+            }
+            // the other paths of the same length are tight now too, take them without another Dijkstra
+            augmentTight(g, colors, mate, potential, parent, workspace.queue);
+        }
+        return collect(mate, colors);
+    }
+
+    /**
+     * Augments along vertex disjoint paths of zero reduced cost from the source to the sink, the shortest ones
+     * under the current potentials, by a depth first search that visits every vertex at most once.
+     * @param next Scratch array of V + 1 entries, the next neighbour to try of every left vertex.
+     * @param stack Storage for the search stack.
+     */
+    void BipartiteMatching::augmentTight(const Graph &g, const StampedArray<int> &colors, std::vector<size_t> &mate,
+                                         const std::vector<long long> &potential, std::vector<size_t> &next,
+                                         std::vector<size_t> &stack) {
+        size_t n = g.V();
+        // a vertex is visited when next holds a position in its list, NO_VERTEX marks the unvisited ones
+        std::fill(next.begin(), next.end(), NO_VERTEX);
+        for (size_t root = 0; root < n; ++root) {
+            // the source arc into a free left vertex is tight when its potential is the source's 0
+            if (colors[root] != 0 || mate[root] != NO_VERTEX || potential[root] != 0 || next[root] != NO_VERTEX)
+                continue;
+            stack.clear();
+            stack.push_back(root);
+            next[root] = 0;
+            while (!stack.empty()) {
+                size_t u = stack.back();
+                const std::vector<size_t> &neighbors = g.neighbors(u);
+                if (next[u] == neighbors.size()) {
+                    stack.pop_back();
+                    if (!stack.empty())
+                        ++next[stack.back()];
+                    continue;
+                }
+
+                size_t v = neighbors[next[u]];
+                if (v == mate[u] || next[v] != NO_VERTEX ||
+                    g.getEdgeWeight(u, v) + potential[u] - potential[v] != 0) {
+                    ++next[u];
+                    continue;
+                }
+                next[v] = 0;
+                if (mate[v] == NO_VERTEX) {
+                    // the arc of a free right vertex into the sink has to be tight as well
+                    if (potential[v] != potential[n]) {
+                        ++next[u];
+                        continue;
+                    }
+                    for (size_t x : stack) {
+                        size_t y = g.neighbors(x)[next[x]];
+                        mate[x] = y;
+                        mate[y] = x;
+                    }
+                    break;
+                }
+                if (next[mate[v]] != NO_VERTEX) {
+                    ++next[u];
+                    continue;
+                }
+                next[mate[v]] = 0;
+                stack.push_back(mate[v]);
+            }
+        }
+    }
+
+    long long BipartiteMatching::totalWeight(const Graph &g, const Matching &matching) {
+        long long weight = 0;
+        for (const std::pair<size_t, size_t> &pair : matching)
+            weight += g.getEdgeWeight(pair.first, pair.second);
+        return weight;
+    }
+
+    std::string BipartiteMatching::toString(const Matching &matching) {
+        std::string result = "Matching of size " + std::to_string(matching.size()) + ":";
+        for (const std::pair<size_t, size_t> &pair : matching)
+            result += " (" + std::to_string(pair.first) + "," + std::to_string(pair.second) + ")";
+        return result;
+    }
+
+    void BipartiteMatching::checkInput(const Graph &g, Workspace &workspace) {
+        if (g.getGraphType() == GraphType::DIRECTED)
+            throw std::invalid_argument("Bipartite matching requires an undirected graph");
+        if (!IsBipartite::colorGraph(g, workspace))
+            throw std::invalid_argument("Graph is not bipartite");
+    }
+
+    BipartiteMatching::Matching BipartiteMatching::collect(const std::vector<size_t> &mate,
+                                                           const StampedArray<int> &colors) {
+        Matching matching;
+        for (size_t u = 0; u < mate.size(); ++u) {
+            if (colors[u] == 0 && mate[u] != NO_VERTEX)
+                matching.emplace_back(u, mate[u]);
+        }
+        return matching;
+    }
+
+    /**
+     * Layers the left vertices by their alternating distance from the free left vertices.
+     * the search stops at the first layer that has an edge to a free right vertex, the length of the shortest
+     * augmenting paths, NO_VERTEX marks the left vertices beyond it.
+     */
+    bool BipartiteMatching::buildLayers(const Graph &g, const StampedArray<int> &colors,
+                                        const std::vector<size_t> &mate, std::vector<size_t> &layer,
+                                        std::vector<size_t> &queue, size_t &freeLayer) {
+        queue.clear();
+        for (size_t u = 0; u < g.V(); ++u) {
+            layer[u] = NO_VERTEX;
+            if (colors[u] == 0 && mate[u] == NO_VERTEX) {
+                layer[u] = 0;
+                queue.push_back(u);
+            }
+        }
+
+        freeLayer = NO_VERTEX;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            size_t u = queue[head];
+            if (layer[u] >= freeLayer)
+                break;
+            for (size_t v : g.neighbors(u)) {
+                size_t w = mate[v];
+                if (w == NO_VERTEX) {
+                    freeLayer = layer[u] + 1;
+                } else if (layer[w] == NO_VERTEX) {
+                    layer[w] = layer[u] + 1;
+                    queue.push_back(w);
+                }
+            }
+        }
+        return freeLayer != NO_VERTEX;
+    }
+
+    /**
+     * Looks for an augmenting path from root that climbs one layer per matched edge, with an explicit stack.
+     * next[u] is the next neighbour of u to try, a left vertex that leads nowhere leaves the layers for the phase.
+     * @return True if the matching grew.
+     */
+    bool BipartiteMatching::augment(const Graph &g, std::vector<size_t> &mate, std::vector<size_t> &layer,
+                                    std::vector<size_t> &next, std::vector<size_t> &stack, size_t root,
+                                    size_t freeLayer) {
+        stack.clear();
+        stack.push_back(root);
+        while (!stack.empty()) {
+            size_t u = stack.back();
+            const std::vector<size_t> &neighbors = g.neighbors(u);
+            if (next[u] == neighbors.size()) {
+                layer[u] = NO_VERTEX;
+                stack.pop_back();
+                if (!stack.empty())
+                    ++next[stack.back()];
+                continue;
+            }
+
+            size_t v = neighbors[next[u]];
+            size_t w = mate[v];
+            if (w == NO_VERTEX && layer[u] + 1 == freeLayer) {
+                // every vertex on the stack takes the neighbour it is trying
+                for (size_t x : stack) {
+                    size_t y = g.neighbors(x)[next[x]];
+                    mate[x] = y;
+                    mate[y] = x;
+                }
+                return true;
+            }
+            if (w != NO_VERTEX && layer[w] != NO_VERTEX && layer[w] == layer[u] + 1)
+                stack.push_back(w);
+            else
+                ++next[u];
+        }
+        return false;
+    }
+}
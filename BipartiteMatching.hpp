@@ -0,0 +1,52 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef BIPARTITE_MATCHING_HPP
+#define BIPARTITE_MATCHING_HPP
+
+#include "Graph.hpp"
+#include "IsBipartite.hpp"
+#include "Workspace.hpp"
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ariel {
+    /**
+     * Matchings of undirected bipartite graphs, on the two sides found by IsBipartite::colorGraph.
+     * a matching is a list of (left, right) pairs sorted by the left vertex, the left side being color 0.
+     */
+    class BipartiteMatching {
+    public:
+        typedef std::vector<std::pair<size_t, size_t>> Matching;
+
+        // maximum cardinality matching by Hopcroft-Karp, the partition and the bfs queue live in workspace
+        static Matching Execute(const Graph &g, Workspace &workspace = Workspace::local());
+        // maximum cardinality matching of minimum total weight by the Hungarian method
+        static Matching assignment(const Graph &g, Workspace &workspace = Workspace::local());
+
+        static long long totalWeight(const Graph &g, const Matching &matching);
+        // the size of the matching followed by its pairs
+        static std::string toString(const Matching &matching);
+
+    private:
+        static const size_t NO_VERTEX = std::numeric_limits<size_t>::max();
+
+        // colors the graph into workspace.colors
+        static void checkInput(const Graph &g, Workspace &workspace);
+        static Matching collect(const std::vector<size_t> &mate, const StampedArray<int> &colors);
+
+        // BFS layers from the free left vertices, false when no augmenting path is left
+        static bool buildLayers(const Graph &g, const StampedArray<int> &colors, const std::vector<size_t> &mate,
+                                std::vector<size_t> &layer, std::vector<size_t> &queue, size_t &freeLayer);
+        // vertex disjoint shortest augmenting paths along the layers, from the free left vertex root
+        static bool augment(const Graph &g, std::vector<size_t> &mate, std::vector<size_t> &layer,
+                            std::vector<size_t> &next, std::vector<size_t> &stack, size_t root, size_t freeLayer);
+        // augments along the tight paths left by a round of the Hungarian method
+        static void augmentTight(const Graph &g, const StampedArray<int> &colors, std::vector<size_t> &mate,
+                                 const std::vector<long long> &potential, std::vector<size_t> &next,
+                                 std::vector<size_t> &stack);
+    };
+}
+
+#endif // BIPARTITE_MATCHING_HPP
@@ -0,0 +1,74 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef BITMAP_HPP
+#define BITMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+namespace ariel {
+    /**
+     * A fixed size set of vertices stored as one bit per vertex.
+     */
+    class Bitmap {
+    public:
+        static const size_t WORD_BITS = 64;
+
+        explicit Bitmap(size_t size = 0) : bits(size), words((size + WORD_BITS - 1) / WORD_BITS, 0) {}
+
+        size_t size() const { return bits; }
+        size_t numWords() const { return words.size(); }
+        uint64_t word(size_t w) const { return words[w]; }
+
+        bool test(size_t i) const { return (words[i / WORD_BITS] >> (i % WORD_BITS)) & 1U; }
+        void set(size_t i) { words[i / WORD_BITS] |= uint64_t(1) << (i % WORD_BITS); }
+        void reset(size_t i) { words[i / WORD_BITS] &= ~(uint64_t(1) << (i % WORD_BITS)); }
+
+        void clear() {
+            for (uint64_t &w : words)
+                w = 0;
+        }
+
+        // number of set bits
+        size_t count() const {
+            size_t total = 0;
+            for (uint64_t w : words)
+                total += static_cast<size_t>(__builtin_popcountll(w));
+            return total;
+        }
+
+        // number of bits set in both bitmaps, which must have the same size
+        size_t countAnd(const Bitmap &other) const {
+            size_t total = 0;
+            for (size_t w = 0; w < words.size(); ++w)
+                total += static_cast<size_t>(__builtin_popcountll(words[w] & other.words[w]));
+            return total;
+        }
+
+        void swap(Bitmap &other) {
+            std::swap(bits, other.bits);
+            words.swap(other.words);
+        }
+
+        // calls fn(i) for every set bit in increasing order
+        template <typename Func>
+        void forEach(Func fn) const {
+            for (size_t w = 0; w < words.size(); ++w) {
+                uint64_t word = words[w];
+                while (word != 0) {
+                    size_t bit = static_cast<size_t>(__builtin_ctzll(word));
+                    fn(w * WORD_BITS + bit);
+                    word &= word - 1;
+                }
+            }
+        }
+
+    private:
+        size_t bits;
+        std::vector<uint64_t> words;
+    };
+}
+
+#endif // BITMAP_HPP
@@ -0,0 +1,125 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "ConnectedComponents.hpp"
+#include <unordered_map>
+
+namespace ariel {
+
+    /**
+     * Computes the connected components of the graph with a lock-free union-find (Afforest).
+     * general strategy: every vertex first links only a couple of its neighbours, which is enough
+     * to reveal the giant component, then only vertices outside that component scan the rest of their edges.
+     * roots are always hooked under the smaller root, so the label of a component is its smallest
+     * vertex and the result does not depend on the number of threads or on scheduling.
+     * for directed graphs every edge is used in both directions, i.e. the weak components are returned.
+     * @param g The graph to label.
+     * @param threads Number of worker threads to use.
+     * @return labels[v] is the smallest vertex in the component of v.
+     */
+    std::vector<size_t> ConnectedComponents::Execute(const Graph &g, size_t threads) {
+        size_t n = g.V();
+        std::vector<std::atomic<size_t>> parent(n);
+        for (size_t v = 0; v < n; ++v)
+            parent[v].store(v);
+
+        // column from which each vertex continues scanning its row
+        std::vector<size_t> cursor(n, 0);
+
+        // Step 1: link the first few neighbours of every vertex
+        for (size_t round = 0; round < SAMPLING_ROUNDS; ++round) {
+            Parallel::forEach(0, n, threads, [&](size_t, size_t u) {
+                for (size_t v = cursor[u]; v < n; ++v) {
+                    if (g.getEdgeWeight(u, v) != 0) {
+                        link(parent, u, v);
+                        cursor[u] = v + 1;
+                        return;
+                    }
+                }
+                cursor[u] = n;
+            });
+        }
+
+        // Step 2: find the component most vertices already belong to
+        size_t giant = mostFrequentRoot(parent);
+
+        // Step 3: finish the remaining edges, vertices of the giant component can be skipped
+        // in undirected graphs since their other edges are seen from the opposite endpoint
+        bool skipGiant = g.getGraphType() == GraphType::UNDIRECTED;
+        Parallel::forEach(0, n, threads, [&](size_t, size_t u) {
+            if (skipGiant && find(parent, u) == giant)
+                return;
+            for (size_t v = cursor[u]; v < n; ++v) {
+                if (g.getEdgeWeight(u, v) != 0)
+                    link(parent, u, v);
+            }
+        });
+
+        // Step 4: flatten the forest so every vertex points at its root
+        std::vector<size_t> labels(n);
+        Parallel::forEach(0, n, threads, [&](size_t, size_t v) {
+            labels[v] = find(parent, v);
+        });
+        return labels;
+    }
+
+    size_t ConnectedComponents::countComponents(const std::vector<size_t> &labels) {
+        size_t count = 0;
+        // a component is counted at its smallest vertex, which is its own label
+        for (size_t v = 0; v < labels.size(); ++v) {
+            if (labels[v] == v)
+                count++;
+        }
+        return count;
+    }
+
+    // find the root of v, halving the path on the way
+    size_t ConnectedComponents::find(std::vector<std::atomic<size_t>> &parent, size_t v) {
+        size_t p = parent[v].load();
+        while (p != v) {
+            size_t grandParent = parent[p].load();
+            // the grandparent stays an ancestor of v no matter what other threads do, so this store is safe
+            if (grandParent != p)
+                parent[v].store(grandParent);
+            v = p;
+            p = grandParent;
+        }
+        return v;
+    }
+
+    // merge the sets of u and v, the larger root is hooked under the smaller one
+    void ConnectedComponents::link(std::vector<std::atomic<size_t>> &parent, size_t u, size_t v) {
+        size_t a = find(parent, u);
+        size_t b = find(parent, v);
+        while (a != b) {
+            if (a < b)
+                std::swap(a, b);
+            // a is the larger root, try to hook it under b
+            size_t expected = a;
+            if (parent[a].compare_exchange_strong(expected, b))
+                return;
+            // another thread moved a first, retry from the new roots
+            a = find(parent, a);
+            b = find(parent, b);
+        }
+    }
+
+    // sample evenly spaced vertices and return the root seen most often
+    size_t ConnectedComponents::mostFrequentRoot(std::vector<std::atomic<size_t>> &parent) {
+        size_t n = parent.size();
+        if (n == 0)
+            return 0;
+        size_t step = std::max<size_t>(1, n / SAMPLE_SIZE);
+        std::unordered_map<size_t, size_t> frequency;
+        size_t best = find(parent, 0);
+        size_t bestCount = 0;
+        for (size_t v = 0; v < n; v += step) {
+            size_t root = find(parent, v);
+            size_t count = ++frequency[root];
+            if (count > bestCount) {
+                bestCount = count;
+                best = root;
+            }
+        }
+        return best;
+    }
+}
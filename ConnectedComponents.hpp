@@ -0,0 +1,31 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef CONNECTED_COMPONENTS_HPP
+#define CONNECTED_COMPONENTS_HPP
+
+#include "Graph.hpp"
+#include "Parallel.hpp"
+#include <vector>
+#include <atomic>
+
+namespace ariel {
+    class ConnectedComponents {
+    public:
+        // label of each vertex, vertices in the same (weakly) connected component share a label
+        static std::vector<size_t> Execute(const Graph &g, size_t threads = Parallel::numThreads());
+        // number of distinct components in a labeling returned by Execute
+        static size_t countComponents(const std::vector<size_t> &labels);
+
+    private:
+        // number of neighbours each vertex links in the sampling rounds
+        static const size_t SAMPLING_ROUNDS = 2;
+        // number of vertices inspected to guess the largest component
+        static const size_t SAMPLE_SIZE = 1024;
+
+        static size_t find(std::vector<std::atomic<size_t>> &parent, size_t v);
+        static void link(std::vector<std::atomic<size_t>> &parent, size_t u, size_t v);
+        static size_t mostFrequentRoot(std::vector<std::atomic<size_t>> &parent);
+    };
+}
+
+#endif // CONNECTED_COMPONENTS_HPP
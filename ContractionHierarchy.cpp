@@ -0,0 +1,294 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "ContractionHierarchy.hpp"
+#include "ShortestPath.hpp"
+#include <queue>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+
+namespace ariel {
+
+    const size_t ContractionHierarchy::NO_VERTEX;
+
+    /**
+     * Builds the contraction hierarchy of the graph.
+     * vertices are contracted one by one in the order of their edge difference (shortcuts added minus edges
+     * removed, plus the number of already contracted neighbours), kept up to date lazily.
+     * contracting v adds a shortcut u->w for every pair of neighbours whose shortest path may run through v,
+     * unless a bounded witness search finds a path of at most the same length that avoids v.
+     * the edges a vertex still has when it is contracted all lead to higher ranked vertices and form the upward graph.
+     * @param g The graph to preprocess, must not contain negative edges.
+     * @throws std::invalid_argument if the graph has negative edges.
+     */
+    ContractionHierarchy::ContractionHierarchy(const Graph &g)
+            : numVertices(g.V()), numShortcuts(0), rank(g.V(), 0), upward(g.V()), backward(g.V()) {
+        if (g.getEdgeNegativity() == EdgeNegativity::NEGATIVE)
+            throw std::invalid_argument("Contraction hierarchies require a graph without negative edges");
+
+        size_t n = g.V();
+        WorkingGraph out(n), in(n);
+        for (size_t u = 0; u < n; ++u) {
+            for (size_t v = 0; v < n; ++v) {
+                if (u != v && g.getEdgeWeight(u, v) != 0)
+                    addEdge(out, in, u, v, g.getEdgeWeight(u, v), NO_VERTEX);
+            }
+        }
+
+        std::vector<bool> contracted(n, false);
+        std::vector<size_t> contractedNeighbours(n, 0);
+        std::priority_queue<std::pair<long, size_t>, std::vector<std::pair<long, size_t>>,
+                std::greater<std::pair<long, size_t>>> queue;
+        for (size_t v = 0; v < n; ++v)
+            queue.emplace(priority(out, in, contractedNeighbours, v), v);
+
+        size_t order = 0;
+        while (!queue.empty()) {
+            size_t v = queue.top().second;
+            queue.pop();
+            if (contracted[v])
+                continue;
+
+            // lazy update: the priority may have grown since v was queued
+            long current = priority(out, in, contractedNeighbours, v);
+            if (!queue.empty() && current > queue.top().first) {
+                queue.emplace(current, v);
+                continue;
+            }
+
+            rank[v] = order++;
+            contracted[v] = true;
+            for (const auto &edge : out[v])
+                upward[v].push_back(Arc{edge.first, edge.second.first, edge.second.second});
+            for (const auto &edge : in[v])
+                backward[v].push_back(Arc{edge.first, edge.second.first, edge.second.second});
+
+            numShortcuts += contract(out, in, v, true);
+
+            // remove v from the working graph
+            for (const auto &edge : out[v]) {
+                in[edge.first].erase(v);
+                contractedNeighbours[edge.first]++;
+            }
+            for (const auto &edge : in[v]) {
+                out[edge.first].erase(v);
+                contractedNeighbours[edge.first]++;
+            }
+            out[v].clear();
+            in[v].clear();
+        }
+    }
+
+    // counts (and adds when apply is set) the shortcuts needed to remove v from the working graph
+    size_t ContractionHierarchy::contract(WorkingGraph &out, WorkingGraph &in, size_t v, bool apply) {
+        size_t shortcuts = 0;
+        for (const auto &incoming : in[v]) {
+            size_t u = incoming.first;
+            for (const auto &outgoing : out[v]) {
+                size_t w = outgoing.first;
+                if (u == w)
+                    continue;
+                int viaV = incoming.second.first + outgoing.second.first;
+
+                // a direct edge that is short enough is already a witness
+                auto direct = out[u].find(w);
+                if (direct != out[u].end() && direct->second.first <= viaV)
+                    continue;
+                if (hasWitness(out, u, w, v, viaV))
+                    continue;
+
+                shortcuts++;
+                if (apply)
+                    addEdge(out, in, u, w, viaV, v);
+            }
+        }
+        return shortcuts;
+    }
+
+    // bounded Dijkstra from u that does not pass through skip
+    bool ContractionHierarchy::hasWitness(const WorkingGraph &out, size_t u, size_t w, size_t skip, int limit) {
+        std::unordered_map<size_t, int> dist;
+        std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>,
+                std::greater<std::pair<int, size_t>>> queue;
+        dist[u] = 0;
+        queue.emplace(0, u);
+        size_t settled = 0;
+
+        while (!queue.empty() && settled < WITNESS_SETTLE_LIMIT) {
+            int d = queue.top().first;
+            size_t x = queue.top().second;
+            queue.pop();
+            if (d > dist[x])
+                continue;
+            if (d > limit)
+                return false;
+            if (x == w)
+                return true;
+            settled++;
+
+            for (const auto &edge : out[x]) {
+                size_t y = edge.first;
+                int candidate = d + edge.second.first;
+                if (y == skip || candidate > limit)
+                    continue;
+                auto known = dist.find(y);
+                if (known == dist.end() || candidate < known->second) {
+                    dist[y] = candidate;
+                    queue.emplace(candidate, y);
+                }
+            }
+        }
+        return false;
+    }
+
+    // edge difference of v plus the number of its contracted neighbours, smaller is contracted first
+    long ContractionHierarchy::priority(WorkingGraph &out, WorkingGraph &in,
+                                        const std::vector<size_t> &contractedNeighbours, size_t v) {
+        long shortcuts = static_cast<long>(contract(out, in, v, false));
+        long removed = static_cast<long>(out[v].size() + in[v].size());
+        return shortcuts - removed + static_cast<long>(contractedNeighbours[v]);
+    }
+
+    // adds u->w to the working graph, keeping the lighter edge if one already exists
+    void ContractionHierarchy::addEdge(WorkingGraph &out, WorkingGraph &in, size_t u, size_t w, int weight,
+                                       size_t middle) {
+        auto existing = out[u].find(w);
+        if (existing != out[u].end() && existing->second.first <= weight)
+            return;
+        out[u][w] = std::make_pair(weight, middle);
+        in[w][u] = std::make_pair(weight, middle);
+    }
+
+    /**
+     * Length of a shortest path: an upward search from the source and one from the destination over the
+     * reversed arcs, the answer is the best vertex reached by both.
+     */
+    int ContractionHierarchy::distance(size_t source, size_t dest) const {
+        checkInput(source, dest);
+        std::unordered_map<size_t, int> forwardDist, backwardDist;
+        std::unordered_map<size_t, size_t> forwardParents, backwardParents;
+        upwardSearch(source, true, forwardDist, forwardParents);
+        upwardSearch(dest, false, backwardDist, backwardParents);
+
+        int best = std::numeric_limits<int>::max();
+        for (const auto &entry : forwardDist) {
+            auto other = backwardDist.find(entry.first);
+            if (other != backwardDist.end())
+                best = std::min(best, entry.second + other->second);
+        }
+        return best;
+    }
+
+    std::vector<size_t> ContractionHierarchy::path(size_t source, size_t dest) const {
+        checkInput(source, dest);
+        std::unordered_map<size_t, int> forwardDist, backwardDist;
+        std::unordered_map<size_t, size_t> forwardParents, backwardParents;
+        upwardSearch(source, true, forwardDist, forwardParents);
+        upwardSearch(dest, false, backwardDist, backwardParents);
+
+        // the meeting vertex of the two searches
+        int best = std::numeric_limits<int>::max();
+        size_t meet = NO_VERTEX;
+        for (const auto &entry : forwardDist) {
+            auto other = backwardDist.find(entry.first);
+            if (other != backwardDist.end() && entry.second + other->second < best) {
+                best = entry.second + other->second;
+                meet = entry.first;
+            }
+        }
+        if (meet == NO_VERTEX)
+            return {};
+
+        // the upward arcs from the source to the meeting vertex
+        std::vector<size_t> chain;
+        for (size_t v = meet; v != source; v = forwardParents.at(v))
+            chain.push_back(v);
+        chain.push_back(source);
+        std::reverse(chain.begin(), chain.end());
+        // followed by the arcs down from the meeting vertex to the destination
+        for (size_t v = meet; v != dest;) {
+            v = backwardParents.at(v);
+            chain.push_back(v);
+        }
+
+        // replace every shortcut by the original edges it stands for
+        std::vector<size_t> result(1, source);
+        for (size_t i = 0; i + 1 < chain.size(); ++i)
+            unpack(chain[i], chain[i + 1], result);
+        return result;
+    }
+
+    std::string ContractionHierarchy::query(size_t source, size_t dest) const {
+        std::vector<size_t> shortestPath = path(source, dest);
+        // same convention as ShortestPath::Execute, a vertex has no path to itself
+        if (shortestPath.empty() || source == dest)
+            return "There is no path from " + std::to_string(source) + " to " + std::to_string(dest);
+        return ShortestPath::constructPath(shortestPath, source, dest);
+    }
+
+    size_t ContractionHierarchy::V() const {
+        return numVertices;
+    }
+
+    size_t ContractionHierarchy::getNumShortcuts() const {
+        return numShortcuts;
+    }
+
+    size_t ContractionHierarchy::getRank(size_t v) const {
+        return rank.at(v);
+    }
+
+    void ContractionHierarchy::checkInput(size_t source, size_t dest) const {
+        if (source >= numVertices || dest >= numVertices)
+            throw std::invalid_argument("Invalid input for finding shortest path");
+    }
+
+    // Dijkstra restricted to arcs that lead to higher ranked vertices
+    void ContractionHierarchy::upwardSearch(size_t start, bool forward, std::unordered_map<size_t, int> &dist,
+                                            std::unordered_map<size_t, size_t> &parents) const {
+        const std::vector<std::vector<Arc>> &arcs = forward ? upward : backward;
+        std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>,
+                std::greater<std::pair<int, size_t>>> queue;
+        dist[start] = 0;
+        queue.emplace(0, start);
+
+        while (!queue.empty()) {
+            int d = queue.top().first;
+            size_t u = queue.top().second;
+            queue.pop();
+            if (d > dist[u])
+                continue;
+            for (const Arc &arc : arcs[u]) {
+                int candidate = d + arc.weight;
+                auto known = dist.find(arc.to);
+                if (known == dist.end() || candidate < known->second) {
+                    dist[arc.to] = candidate;
+                    parents[arc.to] = u;
+                    queue.emplace(candidate, arc.to);
+                }
+            }
+        }
+    }
+
+    // the arc u -> v, stored at whichever endpoint was contracted first
+    const ContractionHierarchy::Arc &ContractionHierarchy::findArc(size_t u, size_t v) const {
+        const std::vector<Arc> &arcs = rank[u] < rank[v] ? upward[u] : backward[v];
+        size_t other = rank[u] < rank[v] ? v : u;
+        for (const Arc &arc : arcs) {
+            if (arc.to == other)
+                return arc;
+        }
+        throw std::runtime_error("Contraction hierarchy is missing an arc");
+    }
+
+    // appends the original vertices of the arc u -> v after u
+    void ContractionHierarchy::unpack(size_t u, size_t v, std::vector<size_t> &path) const {
+        const Arc &arc = findArc(u, v);
+        if (arc.middle == NO_VERTEX) {
+            path.push_back(v);
+            return;
+        }
+        unpack(u, arc.middle, path);
+        unpack(arc.middle, v, path);
+    }
+}
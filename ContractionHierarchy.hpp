@@ -0,0 +1,72 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef CONTRACTION_HIERARCHY_HPP
+#define CONTRACTION_HIERARCHY_HPP
+
+#include "Graph.hpp"
+#include <string>
+#include <vector>
+#include <limits>
+#include <unordered_map>
+
+namespace ariel {
+    /**
+     * Contraction hierarchies: the graph is preprocessed once into an upward graph with shortcuts,
+     * after which point to point queries only explore a small search space around source and destination.
+     * the object is the query engine, it keeps no reference to the original graph.
+     */
+    class ContractionHierarchy {
+    public:
+        // contracts every vertex of the graph, the graph must not have negative edges
+        explicit ContractionHierarchy(const Graph &g);
+
+        // length of a shortest path from source to dest, INT_MAX if there is none
+        [[nodiscard]] int distance(size_t source, size_t dest) const;
+        // the vertices of a shortest path with all shortcuts unpacked, empty if there is none
+        [[nodiscard]] std::vector<size_t> path(size_t source, size_t dest) const;
+        // the shortest path in the same format as ShortestPath::Execute
+        [[nodiscard]] std::string query(size_t source, size_t dest) const;
+
+        [[nodiscard]] size_t V() const;
+        [[nodiscard]] size_t getNumShortcuts() const;
+        // position of v in the contraction order
+        [[nodiscard]] size_t getRank(size_t v) const;
+
+    private:
+        static const size_t NO_VERTEX = std::numeric_limits<size_t>::max();
+        // limit on the vertices a witness search may settle before giving up and adding the shortcut
+        static const size_t WITNESS_SETTLE_LIMIT = 500;
+
+        // an arc of the upward graph, middle is the contracted vertex a shortcut bypasses
+        struct Arc {
+            size_t to;
+            int weight;
+            size_t middle;
+        };
+        // edges between the vertices that are not contracted yet: target -> (weight, middle)
+        typedef std::vector<std::unordered_map<size_t, std::pair<int, size_t>>> WorkingGraph;
+
+        size_t numVertices;
+        size_t numShortcuts;
+        std::vector<size_t> rank;
+        std::vector<std::vector<Arc>> upward;   // upward[u]: arcs u -> v with rank[v] > rank[u]
+        std::vector<std::vector<Arc>> backward; // backward[u]: arcs v -> u with rank[v] > rank[u], stored as to = v
+
+        void checkInput(size_t source, size_t dest) const;
+        // shortcuts needed to contract v, added to the working graph when `apply` is set
+        static size_t contract(WorkingGraph &out, WorkingGraph &in, size_t v, bool apply);
+        // is there a path from u to w avoiding `skip` no longer than limit
+        static bool hasWitness(const WorkingGraph &out, size_t u, size_t w, size_t skip, int limit);
+        static long priority(WorkingGraph &out, WorkingGraph &in, const std::vector<size_t> &contractedNeighbours,
+                             size_t v);
+        static void addEdge(WorkingGraph &out, WorkingGraph &in, size_t u, size_t w, int weight, size_t middle);
+
+        // upward search from source (forward) or dest (backward), distances and parents of the search space
+        void upwardSearch(size_t start, bool forward, std::unordered_map<size_t, int> &dist,
+                          std::unordered_map<size_t, size_t> &parents) const;
+        const Arc &findArc(size_t u, size_t v) const;
+        void unpack(size_t u, size_t v, std::vector<size_t> &path) const;
+    };
+}
+
+#endif // CONTRACTION_HIERARCHY_HPP
@@ -0,0 +1,147 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "DeltaStepping.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace ariel {
+
+    /**
+     * Delta-stepping single source shortest paths (Meyer & Sanders).
+     * vertices are kept in buckets of width delta by their tentative distance, and a whole bucket is settled
+     * at once: light edges (weight <= delta) are relaxed repeatedly until the bucket stops changing,
+     * heavy edges once when the bucket is done.
+     * every vertex is owned by one thread (v % threads), which alone writes its distance and keeps it in its
+     * own buckets. the edge scans of a bucket are split between the threads into request buffers partitioned
+     * by the owner of the target, then every owner applies its requests, so both phases run in parallel
+     * without locks.
+     * @param g The graph, all weights must be non-negative.
+     * @param source The source vertex.
+     * @param delta The bucket width, 0 to derive it from the maximal weight and the average degree.
+     * @param threads Number of worker threads.
+     * @return dist[v] is the length of a shortest path from source to v, INT_MAX if unreachable.
+     */
+    std::vector<int> DeltaStepping::distances(const Graph &g, size_t source, int delta, size_t threads) {
+        threads = std::max<size_t>(1, threads);
+        if (delta <= 0)
+            delta = chooseDelta(g);
+
+        std::vector<int> dist(g.V(), std::numeric_limits<int>::max());
+        OwnedBuckets buckets(threads);
+        RequestBuffers requests(threads, std::vector<std::vector<Request>>(threads));
+        // round in which each vertex was last taken from a bucket, and the bucket it was settled in
+        std::vector<size_t> takenInRound(g.V(), std::numeric_limits<size_t>::max());
+        std::vector<size_t> settledInBucket(g.V(), std::numeric_limits<size_t>::max());
+        // per owner: the entries taken from the current bucket, the live ones among them, and the vertices settled
+        // in the current bucket, whose heavy edges are relaxed at the end
+        std::vector<std::vector<size_t>> taken(threads), active(threads), settled(threads);
+        std::vector<size_t> frontier;
+
+        dist[source] = 0;
+        buckets[source % threads].resize(1);
+        buckets[source % threads][0].push_back(source);
+
+        size_t round = 0;
+        for (size_t i = 0; i < bucketCount(buckets); ++i) {
+            for (std::vector<size_t> &list : settled)
+                list.clear();
+
+            while (true) {
+                round++;
+                // every owner drops its stale entries (the vertex moved to a lower distance) and duplicates
+                Parallel::forEach(0, threads, threads, [&](size_t, size_t owner) {
+                    active[owner].clear();
+                    taken[owner].clear();
+                    if (i < buckets[owner].size())
+                        taken[owner].swap(buckets[owner][i]);
+                    for (size_t v : taken[owner]) {
+                        if (size_t(dist[v] / delta) != i || takenInRound[v] == round)
+                            continue;
+                        takenInRound[v] = round;
+                        active[owner].push_back(v);
+                        if (settledInBucket[v] != i) {
+                            settledInBucket[v] = i;
+                            settled[owner].push_back(v);
+                        }
+                    }
+                }, 1);
+
+                frontier.clear();
+                for (const std::vector<size_t> &list : active)
+                    frontier.insert(frontier.end(), list.begin(), list.end());
+                if (frontier.empty())
+                    break;
+                generateRequests(g, frontier, dist, delta, true, threads, requests);
+                relax(requests, delta, dist, buckets);
+            }
+
+            frontier.clear();
+            for (const std::vector<size_t> &list : settled)
+                frontier.insert(frontier.end(), list.begin(), list.end());
+            generateRequests(g, frontier, dist, delta, false, threads, requests);
+            relax(requests, delta, dist, buckets);
+        }
+        return dist;
+    }
+
+    // bucket width of about max weight / average degree, at least 1, from the counts the graph keeps
+    int DeltaStepping::chooseDelta(const Graph &g) {
+        int maxW = g.getMaxWeight();
+        if (g.E() == 0 || maxW <= 0)
+            return 1;
+
+        size_t averageDegree = std::max<size_t>(1, g.E() / g.V());
+        return std::max(1, maxW / static_cast<int>(std::min<size_t>(averageDegree, size_t(maxW))));
+    }
+
+    // one past the highest bucket index of any owner
+    size_t DeltaStepping::bucketCount(const OwnedBuckets &buckets) {
+        size_t count = 0;
+        for (const std::vector<std::vector<size_t>> &owned : buckets)
+            count = std::max(count, owned.size());
+        return count;
+    }
+
+    // scan the light or the heavy edges of the given vertices in parallel
+    void DeltaStepping::generateRequests(const Graph &g, const std::vector<size_t> &vertices,
+                                         const std::vector<int> &dist, int delta, bool light, size_t threads,
+                                         RequestBuffers &requests) {
+        for (std::vector<std::vector<Request>> &buffers : requests) {
+            for (std::vector<Request> &buffer : buffers)
+                buffer.clear();
+        }
+
+        Parallel::forEach(0, vertices.size(), threads, [&](size_t thread, size_t i) {
+            size_t u = vertices[i];
+            int dist_u = dist[u];
+            g.forEachNeighbor(u, [&](size_t v, int weight) {
+                if ((weight <= delta) != light)
+                    return;
+                if (dist_u + weight < dist[v])
+                    requests[thread][v % threads].push_back(Request(v, dist_u + weight));
+            });
+        }, 1);
+    }
+
+    // every owner applies the requests for its vertices, a vertex with a shorter distance moves to its new bucket
+    void DeltaStepping::relax(const RequestBuffers &requests, int delta, std::vector<int> &dist,
+                              OwnedBuckets &buckets) {
+        size_t owners = buckets.size();
+        Parallel::forEach(0, owners, owners, [&](size_t, size_t owner) {
+            std::vector<std::vector<size_t>> &owned = buckets[owner];
+            for (const std::vector<std::vector<Request>> &buffers : requests) {
+                for (const Request &request : buffers[owner]) {
+                    size_t v = request.first;
+                    int newDist = request.second;
+                    if (newDist >= dist[v])
+                        continue;
+                    dist[v] = newDist;
+                    size_t bucket = size_t(newDist / delta);
+                    if (bucket >= owned.size())
+                        owned.resize(bucket + 1);
+                    owned[bucket].push_back(v);
+                }
+            }
+        }, 1);
+    }
+}
@@ -0,0 +1,35 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef DELTA_STEPPING_HPP
+#define DELTA_STEPPING_HPP
+
+#include "Graph.hpp"
+#include "Parallel.hpp"
+#include <vector>
+#include <utility>
+
+namespace ariel {
+    class DeltaStepping {
+    public:
+        // shortest distances from source in a graph with non-negative weights, INT_MAX for unreachable vertices
+        // delta 0 picks the bucket width from the graph
+        static std::vector<int> distances(const Graph &g, size_t source, int delta = 0,
+                                          size_t threads = Parallel::numThreads());
+
+    private:
+        // a tentative distance for a vertex produced while scanning edges
+        typedef std::pair<size_t, int> Request;
+        // requests[thread][owner] holds what a scanning thread found for the vertices of one owner
+        typedef std::vector<std::vector<std::vector<Request>>> RequestBuffers;
+        // buckets[owner][i] holds the vertices of one owner with a distance in [i * delta, (i + 1) * delta)
+        typedef std::vector<std::vector<std::vector<size_t>>> OwnedBuckets;
+
+        static int chooseDelta(const Graph &g);
+        static size_t bucketCount(const OwnedBuckets &buckets);
+        static void generateRequests(const Graph &g, const std::vector<size_t> &vertices, const std::vector<int> &dist,
+                                     int delta, bool light, size_t threads, RequestBuffers &requests);
+        static void relax(const RequestBuffers &requests, int delta, std::vector<int> &dist, OwnedBuckets &buckets);
+    };
+}
+
+#endif // DELTA_STEPPING_HPP
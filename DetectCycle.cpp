@@ -7,13 +7,14 @@ namespace ariel {
     /**
     * Executes the cycle detection algorithm on the given graph.
     * @param g The graph to detect cycles in.
+    * @param workspace Scratch buffers for the traversal, reused between calls.
     * @return A string describing the detected cycle, or a message indicating no cycle was found.
     */
-    std::string DetectCycle::Execute(const Graph &g) {
+    std::string DetectCycle::Execute(const Graph &g, Workspace &workspace) {
         // empty graph
         if (g.isEmpty())
             return "Graph is empty";
-        return detectCycle(g);
+        return detectCycle(g, workspace);
 
     }
 
@@ -23,14 +24,15 @@ namespace ariel {
     * @param g The graph to detect cycles in.
     * @return A string describing the detected cycle, or a message indicating no cycle was found.
     */
-    std::string DetectCycle::detectCycle(const Graph &g) {
-        // Initialize vectors to track visited vertices and recursion stack
-        std::vector<bool> visited(g.V(), false);
+    std::string DetectCycle::detectCycle(const Graph &g, Workspace &workspace) {
+        // Start a new generation of the visited set, and a vector for the recursion stack
+        VisitedSet &visited = workspace.visited;
+        visited.clear(g.V());
         std::vector<size_t> path; // To store the current path
 
         // Iterate through all vertices and perform DFS to detect cycles
         for (size_t v = 0; v < g.V(); ++v) {
-            if (!visited[v]) {
+            if (!visited.contains(v)) {
                 if (detectCycleDfs(g, v, -1, visited, path))
                     return constructCycleString(path);
             }
@@ -45,12 +47,12 @@ namespace ariel {
        * @param g The graph to detect cycles in.
        * @param v The current vertex being explored.
        * @param parent The parent vertex of the current vertex.
-       * @param visited A vector to track visited vertices.
+       * @param visited The set of visited vertices.
        * @param path A vector to store the current path during traversal.
        * @return True if a cycle is found, false otherwise.
        */
-    bool DetectCycle::detectCycleDfs(const Graph &g, size_t v, int parent, std::vector<bool> &visited, std::vector<size_t> &path) {
-        visited[v] = true;
+    bool DetectCycle::detectCycleDfs(const Graph &g, size_t v, int parent, VisitedSet &visited, std::vector<size_t> &path) {
+        visited.insert(v);
         path.push_back(v);
 
         // Explore all neighbors of vertex v
@@ -76,7 +78,7 @@ namespace ariel {
                     return true;
                 }
                 // If the neighbor has not been visited yet, explore it recursively
-                if (!visited[neighbor] && detectCycleDfs(g, neighbor, v, visited, path))
+                if (!visited.contains(neighbor) && detectCycleDfs(g, neighbor, v, visited, path))
                     return true;
             }
         }
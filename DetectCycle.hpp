@@ -11,10 +11,11 @@ using namespace std;
 namespace ariel {
     class DetectCycle {
     public:
-        static std::string Execute(const Graph &g);
+        // the visited set lives in workspace, the calling thread's one by default
+        static std::string Execute(const Graph &g, Workspace &workspace = Workspace::local());
     private:
-        static std::string detectCycle(const Graph& g);
-        static bool detectCycleDfs(const Graph &g, size_t v,int parent, std::vector<bool> &visited, std::vector<size_t> &path);
+        static std::string detectCycle(const Graph& g, Workspace &workspace);
+        static bool detectCycleDfs(const Graph &g, size_t v,int parent, VisitedSet &visited, std::vector<size_t> &path);
         static std::string constructCycleString(const std::vector<size_t> &path);
     };
 
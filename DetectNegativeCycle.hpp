@@ -6,19 +6,231 @@
 
 #include "Graph.hpp"
 #include "ShortestPath.hpp"
+#include "GraphViews.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <limits>
 #include <string>
 #include <vector>
 
 namespace ariel {
     class DetectNegativeCycle {
     public:
-        static std::string Execute(const Graph &g);
+        // the parent pointers and the queue live in workspace, the calling thread's one by default
+        static std::string Execute(const Graph &g, Workspace &workspace = Workspace::local());
+
+        // the vertices of a negative cycle in edge order, empty if there is none. G is a Graph or a graph view
+        template <typename G>
+        static std::vector<size_t> findCycle(const G &g, Workspace &workspace = Workspace::local());
 
     private:
-        static std::string detectNegativeCycle(const Graph &g);
-        static std::string bellmanFord(const Graph& g, size_t source);
-        static std::string findNegativeCycle(const Graph &g,  std::vector<int> &dist, std::vector<size_t> &predecessors);
+        // the cycle as "a -> b -> ... -> a", starting from its smallest vertex
+        static std::string cycleToString(const std::vector<size_t> &cycle);
+
+        // directed graphs: one pass of Bellman-Ford with subtree disassembly from an implicit super-source
+        template <typename G>
+        static std::vector<size_t> disassembly(const G &g, Workspace &workspace);
+
+        // undirected graphs: Bellman-Ford from every vertex, an edge never relaxed back to the parent it came from
+        template <typename G>
+        static std::vector<size_t> perSource(const G &g, Workspace &workspace);
+
+        // the negative cycle on the parent pointers above v, empty if there is none. the walk up the parents is kept
+        // in workspace.queue and workspace.visited
+        template <typename G>
+        static std::vector<size_t> parentCycle(const G &g, const StampedArray<size_t> &parent, size_t v,
+                                               Workspace &workspace);
     };
+
+    template <typename G>
+    std::vector<size_t> DetectNegativeCycle::findCycle(const G &g, Workspace &workspace) {
+        if (g.getGraphType() == GraphType::DIRECTED)
+            return disassembly(g, workspace);
+        return perSource(g, workspace);
+    }
+
+    /**
+     * Bellman-Ford with Tarjan's subtree disassembly.
+     * every vertex starts at distance 0, as if an implicit super-source had an edge of weight 0 to it, and the
+     * shortest path tree is kept as a preorder list. relaxing u->v first walks the subtree of v: meeting u there
+     * means the tree path v..u plus the edge u->v is a negative cycle, reported right away, otherwise the subtree
+     * is cut off (its distances are outdated, so its vertices are not scanned until they improve again) and v is
+     * moved under u. every tree path is a simple path, so a cycle is found as soon as it forms.
+     * undirected graphs do not go through here: every vertex starting at distance 0 with the parent edge
+     * skipped misses cycles whose negative edges each lead away from a common vertex.
+     */
+    template <typename G>
+    std::vector<size_t> DetectNegativeCycle::disassembly(const G &g, Workspace &workspace) {
+        size_t n = g.V();
+        size_t root = n; // the implicit super-source
+
+        std::vector<long long> dist(n, 0);
+        StampedArray<size_t> &parent = workspace.predecessors;
+        parent.reset(n + 1, root);
+        // the tree in preorder as a circular list through the root, depth tells where a subtree ends
+        std::vector<size_t> next(n + 1), prev(n + 1), depth(n + 1, 1);
+        std::vector<bool> active(n, true), queued(n, true);
+        depth[root] = 0;
+        for (size_t v = 0; v <= n; ++v) {
+            next[v] = v == n ? 0 : v + 1;
+            prev[v] = v == 0 ? n : v - 1;
+        }
+
+        // every vertex is queued at most once, so a ring of n slots holds the FIFO queue
+        std::vector<size_t> &queue = workspace.queue;
+        queue.resize(n);
+        for (size_t v = 0; v < n; ++v)
+            queue[v] = v;
+        size_t head = 0, count = n;
+
+        std::vector<size_t> cycle;
+        while (count > 0 && cycle.empty()) {
+            size_t u = queue[head];
+            head = head + 1 == n ? 0 : head + 1;
+            count--;
+            queued[u] = false;
+            // vertices cut out of the tree wait until their distance improves again
+            if (!active[u])
+                continue;
+
+            size_t closing = root;
+            g.forEachNeighbor(u, [&](size_t v, int weight) {
+                if (closing != root || dist[u] + weight >= dist[v])
+                    return;
+                if (v == u) {
+                    closing = v;
+                    return;
+                }
+                if (active[v]) {
+                    // disassemble the subtree of v
+                    size_t x = next[v];
+                    while (depth[x] > depth[v]) {
+                        if (x == u) {
+                            closing = v;
+                            return;
+                        }
+                        active[x] = false;
+                        x = next[x];
+                    }
+                    next[prev[v]] = x;
+                    prev[x] = prev[v];
+                }
+                // hang v under u
+                dist[v] = dist[u] + weight;
+                parent[v] = u;
+                depth[v] = depth[u] + 1;
+                active[v] = true;
+                next[v] = next[u];
+                prev[next[u]] = v;
+                next[u] = v;
+                prev[v] = u;
+                if (!queued[v]) {
+                    queued[v] = true;
+                    queue[(head + count) % n] = v;
+                    count++;
+                }
+            });
+
+            // the tree path closing..u followed by the edge u -> closing
+            if (closing != root) {
+                for (size_t v = u; v != closing; v = parent[v])
+                    cycle.push_back(v);
+                cycle.push_back(closing);
+                std::reverse(cycle.begin(), cycle.end());
+            }
+        }
+        return cycle;
+    }
+
+    /**
+     * Bellman-Ford from every vertex in turn over the adjacency lists, like the original detection: a single
+     * negative edge would relax back and forth forever, so an edge is never relaxed back to the parent it came
+     * from. a relaxation still possible after V - 1 rounds marks a negative cycle, which is read from the parent
+     * pointers above its end.
+     * this costs O(V^2 E) on an undirected graph. a single pass is not enough there, and an exact faster engine
+     * needs a reduction to minimum weight T-joins through matchings, which is out of scope here.
+     */
+    template <typename G>
+    std::vector<size_t> DetectNegativeCycle::perSource(const G &g, Workspace &workspace) {
+        size_t n = g.V();
+        const long long INF = std::numeric_limits<long long>::max();
+        StampedArray<size_t> &parent = workspace.predecessors;
+        std::vector<long long> dist(n);
+
+        for (size_t source = 0; source < n; ++source) {
+            std::fill(dist.begin(), dist.end(), INF);
+            parent.reset(n, n);
+            dist[source] = 0;
+            for (size_t round = 0; round + 1 < n; ++round) {
+                bool changed = false;
+                for (size_t u = 0; u < n; ++u) {
+                    if (dist[u] == INF)
+                        continue;
+                    g.forEachNeighbor(u, [&](size_t v, int weight) {
+                        if (parent[u] != v && dist[u] + weight < dist[v]) {
+                            dist[v] = dist[u] + weight;
+                            parent[v] = u;
+                            changed = true;
+                        }
+                    });
+                }
+                if (!changed)
+                    break;
+            }
+
+            for (size_t u = 0; u < n; ++u) {
+                if (dist[u] == INF)
+                    continue;
+                std::vector<size_t> cycle;
+                g.forEachNeighbor(u, [&](size_t v, int weight) {
+                    if (cycle.empty() && parent[u] != v && dist[u] + weight < dist[v]) {
+                        size_t previous = parent[v];
+                        parent[v] = u;
+                        cycle = parentCycle(g, parent, v, workspace);
+                        if (cycle.empty())
+                            parent[v] = previous;
+                    }
+                });
+                if (!cycle.empty())
+                    return cycle;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * Follows the parent pointers up from v until a vertex repeats, and returns the loop they close if it is a
+     * cycle of at least three vertices with negative weight.
+     */
+    template <typename G>
+    std::vector<size_t> DetectNegativeCycle::parentCycle(const G &g, const StampedArray<size_t> &parent, size_t v,
+                                                         Workspace &workspace) {
+        size_t n = g.V();
+        std::vector<size_t> &walk = workspace.queue;
+        VisitedSet &seen = workspace.visited;
+        walk.clear();
+        seen.clear(n);
+        while (v < n && seen.insert(v)) {
+            walk.push_back(v);
+            v = parent[v];
+        }
+        if (v >= n)
+            return {};
+
+        // the loop starts where v was first met, and runs against the edges
+        std::vector<size_t>::iterator first = std::find(walk.begin(), walk.end(), v);
+        long long weight = 0;
+        size_t length = size_t(walk.end() - first);
+        for (std::vector<size_t>::iterator it = first; it != walk.end(); ++it)
+            weight += g.getEdgeWeight(parent[*it], *it);
+        if (length < 3 || weight >= 0)
+            return {};
+
+        // reverse it into edge order
+        std::vector<size_t> cycle(first, walk.end());
+        std::reverse(cycle.begin(), cycle.end());
+        return cycle;
+    }
 }
 
 
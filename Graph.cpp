@@ -1,22 +1,29 @@
 //written by Ido Avraham : 208699181
 //EMAIL: idoavraham086@gmail.com
 #include "Graph.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
 namespace ariel {
 
     /**
     * Constructs an empty graph with default attributes.
     */
-    Graph::Graph() : numVertices(0), numEdges(0), graphType(GraphType::UNDIRECTED),
+    Graph::Graph() : numVertices(0), numEdges(0), maxWeight(0), graphType(GraphType::UNDIRECTED),
                      edgeType(EdgeType::UNWEIGHTED), edgeNegativity(EdgeNegativity::NONE) {}
 
     // Copy constructor
     Graph::Graph(const Graph& other) {
         this->numVertices = other.numVertices;
         this->numEdges = other.numEdges;
+        this->maxWeight = other.maxWeight;
         this->graphType = other.graphType;
         this->edgeType = other.edgeType;
         this->edgeNegativity = other.edgeNegativity;
         this->adjacencyMatrix = other.adjacencyMatrix; // Deep copy of the adjacency matrix
+        this->adjacencyList = other.adjacencyList;
+        this->incomingList = other.incomingList;
+        this->degrees = other.degrees;
+        this->inDegrees = other.inDegrees;
     }
 
 
@@ -36,12 +43,19 @@ namespace ariel {
         this->numVertices = matrix.size();
         this->adjacencyMatrix = matrix;
         this->numEdges = 0;
+        this->adjacencyList.assign(numVertices, std::vector<size_t>());
+        this->incomingList.assign(numVertices, std::vector<size_t>());
+        this->inDegrees.assign(numVertices, 0);
 
         // Count edges and check for weighted and negative edges
         for (size_t i = 0; i < numVertices; ++i) {
             for (size_t j = 0; j < numVertices; ++j) {
                 if (adjacencyMatrix[i][j] != 0) {
                     this->numEdges++;
+                    this->adjacencyList[i].push_back(j);
+                    this->incomingList[j].push_back(i);
+                    this->inDegrees[j]++;
+                    this->maxWeight = std::max(this->maxWeight, adjacencyMatrix[i][j]);
                     if (adjacencyMatrix[i][j] != 1) {
                         this->edgeType = EdgeType::WEIGHTED;
                         if (adjacencyMatrix[i][j] < 0) {
@@ -56,6 +70,15 @@ namespace ariel {
         if (!isSymmetricMatrix(matrix)) {
             this->graphType = GraphType::DIRECTED;
         }
+
+        // the degrees are needed by several algorithms, so they are counted once here rather than per call
+        this->degrees.assign(numVertices, 0);
+        for (size_t i = 0; i < numVertices; ++i) {
+            size_t loops = adjacencyMatrix[i][i] != 0 ? 1 : 0;
+            this->degrees[i] = adjacencyList[i].size() - loops;
+            if (this->graphType == GraphType::DIRECTED)
+                this->degrees[i] += inDegrees[i] - loops;
+        }
     }
 
 
@@ -66,7 +89,12 @@ namespace ariel {
     void Graph::clearGraph() {
         this->numVertices = 0;
         this->numEdges = 0;
+        this->maxWeight = 0;
         this->adjacencyMatrix.clear();
+        this->adjacencyList.clear();
+        this->incomingList.clear();
+        this->degrees.clear();
+        this->inDegrees.clear();
         this->graphType = GraphType::UNDIRECTED;
         this->edgeType = EdgeType::UNWEIGHTED;
         this->edgeNegativity = EdgeNegativity::NONE;
@@ -127,10 +155,35 @@ namespace ariel {
         return numVertices;
     }
 
+    size_t Graph::E() const {
+        return numEdges;
+    }
+
     int Graph::getEdgeWeight(size_t u, size_t v) const {
         return adjacencyMatrix[u][v];
     }
 
+    // the largest edge weight, 0 for a graph without positive edges
+    int Graph::getMaxWeight() const {
+        return maxWeight;
+    }
+
+    const std::vector<size_t>& Graph::neighbors(size_t u) const {
+        return adjacencyList[u];
+    }
+
+    size_t Graph::outDegree(size_t u) const {
+        return adjacencyList[u].size();
+    }
+
+    size_t Graph::inDegree(size_t u) const {
+        return inDegrees[u];
+    }
+
+    size_t Graph::degree(size_t u) const {
+        return degrees[u];
+    }
+
     Graph Graph::getReversedGraph() const {
         // Create a new graph
         Graph reversedGraph;
@@ -226,12 +279,17 @@ namespace ariel {
             // Copy other attributes
             this->numVertices = other.numVertices;
             this->numEdges = other.numEdges;
+            this->maxWeight = other.maxWeight;
             this->graphType = other.graphType;
             this->edgeType = other.edgeType;
             this->edgeNegativity = other.edgeNegativity;
 
             // Deep copy of the adjacency matrix
             this->adjacencyMatrix = other.adjacencyMatrix;
+            this->adjacencyList = other.adjacencyList;
+            this->incomingList = other.incomingList;
+            this->degrees = other.degrees;
+            this->inDegrees = other.inDegrees;
         }
         return *this;
     }
@@ -444,6 +502,77 @@ namespace ariel {
         return *this;
     }
 
+    std::vector<double> Graph::operator*(const std::vector<double> &x) const {
+        return multiplyVector(x);
+    }
+
+    std::vector<float> Graph::operator*(const std::vector<float> &x) const {
+        return multiplyVector(x);
+    }
+
+    std::vector<double> Graph::transposeMultiply(const std::vector<double> &x) const {
+        return multiplyTransposedVector(x);
+    }
+
+    std::vector<float> Graph::transposeMultiply(const std::vector<float> &x) const {
+        return multiplyTransposedVector(x);
+    }
+
+    /**
+     * Matrix-vector product.
+     * every row writes only its own entry, so the rows are split between the threads without atomics.
+     * a dense matrix is scanned row by row, which the compiler vectorises, a sparse one through the adjacency lists.
+     * @param x A vector with an entry per vertex.
+     * @return The product of the adjacency matrix and x.
+     * @throws std::invalid_argument if the size of x is not the number of vertices.
+     */
+    template <typename Real>
+    std::vector<Real> Graph::multiplyVector(const std::vector<Real> &x) const {
+        if (x.size() != numVertices)
+            throw std::invalid_argument("The size of the vector must be equal to the number of vertices.");
+
+        std::vector<Real> result(numVertices, Real(0));
+        bool dense = numEdges * 4 >= numVertices * numVertices;
+        size_t threads = numVertices > PARALLEL_THRESHOLD ? Parallel::numThreads() : 1;
+        Parallel::forEach(0, numVertices, threads, [&](size_t, size_t i) {
+            Real sum = 0;
+            const std::vector<int> &row = adjacencyMatrix[i];
+            if (dense) {
+                for (size_t j = 0; j < numVertices; ++j)
+                    sum += static_cast<Real>(row[j]) * x[j];
+            } else {
+                for (size_t j : adjacencyList[i])
+                    sum += static_cast<Real>(row[j]) * x[j];
+            }
+            result[i] = sum;
+        }, 16);
+        return result;
+    }
+
+    /**
+     * Product of the transposed matrix and a vector, read through the cached in-neighbour lists.
+     * every column writes only its own entry, so the columns are split between the threads without atomics,
+     * and no transposed copy of the matrix is made.
+     * @param x A vector with an entry per vertex.
+     * @return The product of the transposed adjacency matrix and x.
+     * @throws std::invalid_argument if the size of x is not the number of vertices.
+     */
+    template <typename Real>
+    std::vector<Real> Graph::multiplyTransposedVector(const std::vector<Real> &x) const {
+        if (x.size() != numVertices)
+            throw std::invalid_argument("The size of the vector must be equal to the number of vertices.");
+
+        std::vector<Real> result(numVertices, Real(0));
+        size_t threads = numVertices > PARALLEL_THRESHOLD ? Parallel::numThreads() : 1;
+        Parallel::forEach(0, numVertices, threads, [&](size_t, size_t j) {
+            Real sum = 0;
+            for (size_t i : incomingList[j])
+                sum += static_cast<Real>(adjacencyMatrix[i][j]) * x[i];
+            result[j] = sum;
+        }, 16);
+        return result;
+    }
+
     // scalar multiply
     Graph Graph::operator*(const double scalar) const {
         if(this->isEmpty())
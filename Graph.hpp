@@ -18,8 +18,16 @@ namespace ariel {
     class Graph {
     private:
         std::vector<std::vector<int>> adjacencyMatrix;
+        // out-neighbours of every vertex in increasing order, built from the matrix on load
+        std::vector<std::vector<size_t>> adjacencyList;
+        // in-neighbours of every vertex in increasing order, the columns of the matrix, built on load
+        std::vector<std::vector<size_t>> incomingList;
+        // degrees cached on load, see degree() and inDegree()
+        std::vector<size_t> degrees;
+        std::vector<size_t> inDegrees;
         size_t numVertices;
         size_t numEdges;
+        int maxWeight;
         GraphType graphType;
         EdgeType edgeType;
         EdgeNegativity edgeNegativity;
@@ -27,6 +35,10 @@ namespace ariel {
         void clearGraph() ;
         [[nodiscard]] static bool isValidGraph(const std::vector<std::vector<int>>& adjacencyMatrix) ;
         [[nodiscard]] static bool isSymmetricMatrix(const std::vector<std::vector<int>>& matrix) ;
+        template <typename Real>
+        std::vector<Real> multiplyVector(const std::vector<Real>& x) const;
+        template <typename Real>
+        std::vector<Real> multiplyTransposedVector(const std::vector<Real>& x) const;
 
     public:
         Graph();
@@ -40,10 +52,27 @@ namespace ariel {
 
         // getters
         [[nodiscard]] size_t V() const;
+        // number of non-zero entries of the matrix, an undirected edge counts twice
+        [[nodiscard]] size_t E() const;
         [[nodiscard]] GraphType getGraphType() const;
         [[nodiscard]] EdgeType getEdgeType() const;
         [[nodiscard]] EdgeNegativity getEdgeNegativity() const;
         [[nodiscard]] int getEdgeWeight(size_t u, size_t v) const;
+        [[nodiscard]] int getMaxWeight() const;
+        // the vertices v with an edge u->v, in increasing order
+        [[nodiscard]] const std::vector<size_t>& neighbors(size_t u) const;
+        // number of edges u->v, neighbors(u).size()
+        [[nodiscard]] size_t outDegree(size_t u) const;
+        // number of edges v->u
+        [[nodiscard]] size_t inDegree(size_t u) const;
+        // number of edges at u without its self loop, in and out edges both counted on a directed graph
+        [[nodiscard]] size_t degree(size_t u) const;
+        // calls fn(v, weight) for every edge u->v, in increasing v, the same call the graph views answer
+        template <typename Func>
+        void forEachNeighbor(size_t u, Func fn) const {
+            for (size_t v : adjacencyList[u])
+                fn(v, adjacencyMatrix[u][v]);
+        }
         [[nodiscard]] Graph getReversedGraph() const;
         [[nodiscard]] Graph addVertexWithEdges() const;
 
@@ -78,6 +107,13 @@ namespace ariel {
         Graph operator*(Graph& other) const;
         Graph& operator*=(Graph& other);
 
+        // matrix-vector product, entry i is the sum of weight(i, j) * x[j], large graphs use all cores
+        std::vector<double> operator*(const std::vector<double>& x) const;
+        std::vector<float> operator*(const std::vector<float>& x) const;
+        // product of the transposed matrix and x, entry j is the sum of weight(i, j) * x[i], without copying the matrix
+        std::vector<double> transposeMultiply(const std::vector<double>& x) const;
+        std::vector<float> transposeMultiply(const std::vector<float>& x) const;
+
         // inc and dec operators
         Graph& operator--() ; // prefix
         Graph& operator++() ; // prefix
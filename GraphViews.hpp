@@ -0,0 +1,143 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef GRAPH_VIEWS_HPP
+#define GRAPH_VIEWS_HPP
+
+#include "Graph.hpp"
+#include <vector>
+
+/**
+ * Lightweight views over a graph that answer the read interface of Graph (V, getEdgeWeight, getGraphType and
+ * forEachNeighbor) without copying the adjacency matrix.
+ * a view keeps a reference to the graph it wraps, which must outlive it. views can wrap other views, and the
+ * algorithms that are templated on the graph type accept a Graph and any view alike.
+ */
+namespace ariel {
+
+    // the graph with every edge u->v turned into v->u
+    template <typename G = Graph>
+    class ReversedView {
+    public:
+        explicit ReversedView(const G &g) : g(g) {}
+
+        size_t V() const { return g.V(); }
+        GraphType getGraphType() const { return g.getGraphType(); }
+        int getEdgeWeight(size_t u, size_t v) const { return g.getEdgeWeight(v, u); }
+
+        // calls fn(v, weight) for every edge u->v, in increasing v
+        template <typename Func>
+        void forEachNeighbor(size_t u, Func fn) const {
+            for (size_t v = 0; v < g.V(); ++v) {
+                int weight = g.getEdgeWeight(v, u);
+                if (weight != 0)
+                    fn(v, weight);
+            }
+        }
+
+    private:
+        const G &g;
+    };
+
+    // the subgraph induced by the vertices with keep[v] set, the others stay in place without any edges
+    template <typename G = Graph>
+    class VertexMaskView {
+    public:
+        VertexMaskView(const G &g, const std::vector<bool> &keep) : g(g), keep(keep) {}
+
+        size_t V() const { return g.V(); }
+        GraphType getGraphType() const { return g.getGraphType(); }
+        int getEdgeWeight(size_t u, size_t v) const { return keep[u] && keep[v] ? g.getEdgeWeight(u, v) : 0; }
+
+        template <typename Func>
+        void forEachNeighbor(size_t u, Func fn) const {
+            if (!keep[u])
+                return;
+            g.forEachNeighbor(u, [&](size_t v, int weight) {
+                if (keep[v])
+                    fn(v, weight);
+            });
+        }
+
+    private:
+        const G &g;
+        const std::vector<bool> &keep;
+    };
+
+    // the graph with only the edges u->v of weight w for which keep(u, v, w) holds
+    template <typename Predicate, typename G = Graph>
+    class EdgeFilterView {
+    public:
+        EdgeFilterView(const G &g, Predicate keep) : g(g), keep(keep) {}
+
+        size_t V() const { return g.V(); }
+        GraphType getGraphType() const { return g.getGraphType(); }
+        int getEdgeWeight(size_t u, size_t v) const {
+            int weight = g.getEdgeWeight(u, v);
+            return weight != 0 && keep(u, v, weight) ? weight : 0;
+        }
+
+        template <typename Func>
+        void forEachNeighbor(size_t u, Func fn) const {
+            g.forEachNeighbor(u, [&](size_t v, int weight) {
+                if (keep(u, v, weight))
+                    fn(v, weight);
+            });
+        }
+
+    private:
+        const G &g;
+        Predicate keep;
+    };
+
+    /**
+     * The graph plus one virtual vertex, numbered V() of the wrapped graph, with an edge of the given weight to
+     * every vertex (and back again in undirected graphs), the view version of Graph::addVertexWithEdges.
+     */
+    template <typename G = Graph>
+    class SuperSourceView {
+    public:
+        SuperSourceView(const G &g, int weight) : g(g), weight(weight) {}
+
+        size_t V() const { return g.V() + 1; }
+        size_t source() const { return g.V(); }
+        GraphType getGraphType() const { return g.getGraphType(); }
+        int getEdgeWeight(size_t u, size_t v) const {
+            if (u == source())
+                return v == source() ? 0 : weight;
+            if (v == source())
+                return g.getGraphType() == GraphType::UNDIRECTED ? weight : 0;
+            return g.getEdgeWeight(u, v);
+        }
+
+        template <typename Func>
+        void forEachNeighbor(size_t u, Func fn) const {
+            if (u == source()) {
+                for (size_t v = 0; v < g.V(); ++v)
+                    fn(v, weight);
+                return;
+            }
+            g.forEachNeighbor(u, fn);
+            if (g.getGraphType() == GraphType::UNDIRECTED)
+                fn(source(), weight);
+        }
+
+    private:
+        const G &g;
+        int weight;
+    };
+
+    // helpers that deduce the wrapped type
+    template <typename G>
+    ReversedView<G> reversedView(const G &g) { return ReversedView<G>(g); }
+
+    template <typename G>
+    VertexMaskView<G> vertexMaskView(const G &g, const std::vector<bool> &keep) { return VertexMaskView<G>(g, keep); }
+
+    template <typename G, typename Predicate>
+    EdgeFilterView<Predicate, G> edgeFilterView(const G &g, Predicate keep) { return EdgeFilterView<Predicate, G>(g, keep); }
+
+    template <typename G>
+    SuperSourceView<G> superSourceView(const G &g, int weight) { return SuperSourceView<G>(g, weight); }
+}
+
+#endif // GRAPH_VIEWS_HPP
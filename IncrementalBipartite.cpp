@@ -0,0 +1,151 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "IncrementalBipartite.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace ariel {
+
+    IncrementalBipartite::IncrementalBipartite(size_t numVertices)
+            : parent(numVertices), size(numVertices, 1), parity(numVertices, 0), forest(numVertices) {
+        std::iota(parent.begin(), parent.end(), size_t(0));
+    }
+
+    IncrementalBipartite::IncrementalBipartite(const Graph &g) : IncrementalBipartite(g.V()) {
+        bool undirected = g.getGraphType() == GraphType::UNDIRECTED;
+        for (size_t u = 0; u < g.V(); ++u) {
+            for (size_t v : g.neighbors(u)) {
+                if (!undirected || u <= v)
+                    addEdge(u, v);
+            }
+        }
+    }
+
+    size_t IncrementalBipartite::addVertex() {
+        parent.push_back(parent.size());
+        size.push_back(1);
+        parity.push_back(0);
+        forest.emplace_back();
+        return parent.size() - 1;
+    }
+
+    /**
+     * Inserts an edge.
+     * an edge between two components joins them with the parities set so that u and v are on different sides,
+     * an edge inside a component is consistent when u and v are already on different sides. the first
+     * inconsistent one closes an odd cycle: the even path between its endpoints in the spanning forest plus the
+     * edge itself. later edges still join components, the graph stays not bipartite.
+     * @param u One endpoint.
+     * @param v The other endpoint, equal to u for a self loop.
+     * @return True if the graph is still bipartite.
+     * @throws std::invalid_argument if a vertex is out of range.
+     */
+    bool IncrementalBipartite::addEdge(size_t u, size_t v) {
+        checkVertex(u);
+        checkVertex(v);
+        size_t rootU = find(u), rootV = find(v);
+        if (rootU == rootV) {
+            if (parity[u] == parity[v] && cycle.empty())
+                cycle = forestPath(u, v);
+            return cycle.empty();
+        }
+
+        // hang the smaller tree under the larger one
+        int between = parity[u] ^ parity[v] ^ 1;
+        if (size[rootU] < size[rootV])
+            std::swap(rootU, rootV);
+        parent[rootV] = rootU;
+        parity[rootV] = between;
+        size[rootU] += size[rootV];
+        forest[u].push_back(v);
+        forest[v].push_back(u);
+        return cycle.empty();
+    }
+
+    bool IncrementalBipartite::isBipartite() const {
+        return cycle.empty();
+    }
+
+    bool IncrementalBipartite::connected(size_t u, size_t v) {
+        checkVertex(u);
+        checkVertex(v);
+        return find(u) == find(v);
+    }
+
+    int IncrementalBipartite::side(size_t v) {
+        checkVertex(v);
+        find(v);
+        return parity[v];
+    }
+
+    const std::vector<size_t> &IncrementalBipartite::oddCycle() const {
+        return cycle;
+    }
+
+    std::string IncrementalBipartite::toString() const {
+        if (cycle.empty())
+            return "Graph is bipartite";
+        // start from the smallest vertex, so the same cycle always reads the same
+        size_t start = size_t(std::min_element(cycle.begin(), cycle.end()) - cycle.begin());
+        std::string result = "Odd cycle found: ";
+        for (size_t i = 0; i < cycle.size(); ++i)
+            result += std::to_string(cycle[(start + i) % cycle.size()]) + " -> ";
+        return result + std::to_string(cycle[start]);
+    }
+
+    size_t IncrementalBipartite::V() const {
+        return parent.size();
+    }
+
+    void IncrementalBipartite::checkVertex(size_t v) const {
+        if (v >= parent.size())
+            throw std::invalid_argument("Invalid vertex");
+    }
+
+    size_t IncrementalBipartite::find(size_t v) {
+        // first pass finds the root, second pass points the path at it with the parities summed from the top
+        size_t root = v;
+        int total = 0;
+        while (parent[root] != root) {
+            total ^= parity[root];
+            root = parent[root];
+        }
+        while (parent[v] != root && v != root) {
+            size_t next = parent[v];
+            int rest = total ^ parity[v];
+            parent[v] = root;
+            parity[v] = total;
+            total = rest;
+            v = next;
+        }
+        return root;
+    }
+
+    /**
+     * BFS over the spanning forest from u until v is found, only u's tree is visited.
+     * @return The vertices of the path, from u to v.
+     */
+    std::vector<size_t> IncrementalBipartite::forestPath(size_t u, size_t v) const {
+        const size_t NONE = std::numeric_limits<size_t>::max();
+        std::vector<size_t> previous(parent.size(), NONE);
+        std::vector<size_t> queue(1, u);
+        previous[u] = u;
+        for (size_t head = 0; head < queue.size() && previous[v] == NONE; ++head) {
+            for (size_t w : forest[queue[head]]) {
+                if (previous[w] == NONE) {
+                    previous[w] = queue[head];
+                    queue.push_back(w);
+                }
+            }
+        }
+
+        std::vector<size_t> path;
+        for (size_t w = v; w != u; w = previous[w])
+            path.push_back(w);
+        path.push_back(u);
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+}
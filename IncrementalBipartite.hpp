@@ -0,0 +1,54 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef INCREMENTAL_BIPARTITE_HPP
+#define INCREMENTAL_BIPARTITE_HPP
+
+#include "Graph.hpp"
+#include <string>
+#include <vector>
+
+namespace ariel {
+    /**
+     * Bipartiteness of a graph that grows one edge at a time, by union-find with the parity of every vertex
+     * relative to its root. an edge costs near constant time, and the first edge that closes an odd cycle is
+     * answered with the cycle, found on a spanning forest of the edges that joined components.
+     * edges are undirected, a directed graph is checked on its underlying undirected graph like IsBipartite does.
+     */
+    class IncrementalBipartite {
+    public:
+        explicit IncrementalBipartite(size_t numVertices = 0);
+        // inserts every edge of the graph
+        explicit IncrementalBipartite(const Graph &g);
+
+        // adds an isolated vertex and returns it
+        size_t addVertex();
+        // inserts the edge u-v, returns false once the graph is not bipartite
+        bool addEdge(size_t u, size_t v);
+
+        [[nodiscard]] bool isBipartite() const;
+        [[nodiscard]] bool connected(size_t u, size_t v);
+        // 0 or 1, vertices of one component with different sides have an odd path between them
+        [[nodiscard]] int side(size_t v);
+        // the odd cycle closed by the first conflicting edge, empty while the graph is bipartite
+        [[nodiscard]] const std::vector<size_t> &oddCycle() const;
+        // the odd cycle as a string, starting from its smallest vertex
+        [[nodiscard]] std::string toString() const;
+
+        [[nodiscard]] size_t V() const;
+
+    private:
+        std::vector<size_t> parent;
+        std::vector<size_t> size;
+        std::vector<int> parity; // parity of the path from a vertex to its parent
+        std::vector<std::vector<size_t>> forest; // the edges that joined two components
+        std::vector<size_t> cycle;
+
+        void checkVertex(size_t v) const;
+        // the root of v, compresses the path and leaves the parity of v relative to the root in parity[v]
+        size_t find(size_t v);
+        // the path from u to v in the spanning forest, both must be in the same tree
+        std::vector<size_t> forestPath(size_t u, size_t v) const;
+    };
+}
+
+#endif // INCREMENTAL_BIPARTITE_HPP
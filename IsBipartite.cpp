@@ -6,25 +6,43 @@ namespace ariel {
     /**
      * Determines whether the graph is bipartite or not.
      * @param g The graph to check for bipartite.
+     * @param workspace Scratch buffers for the coloring, reused between calls.
      * @return A string describing the bipartite partitioning of the graph, or an error message if the graph is not bipartite.
      */
-    std::string IsBipartite::Execute(const ariel::Graph &g) {
+    std::string IsBipartite::Execute(const ariel::Graph &g, Workspace &workspace) {
         // empty graph
         if(g.isEmpty())
             return "Graph is empty";
 
-        std::vector<int> colors(g.V(), -1); // Initialize all colors to -1
+        if (!colorGraph(g, workspace))
+            return "Graph is not bipartite";
+        return FindPartition(workspace.colors); // Graph is bipartite
+    }
+
+    /**
+     * Colors the graph with two colors so that no edge joins two vertices of the same color.
+     * the coloring is left in workspace.colors for the engines that work on the partition, like the matchings.
+     * @param g The graph to color.
+     * @param workspace Scratch buffers for the coloring, receives the colors.
+     * @return True if the graph is bipartite, false otherwise.
+     */
+    bool IsBipartite::colorGraph(const ariel::Graph &g, Workspace &workspace) {
+        StampedArray<int> &colors = workspace.colors;
+        colors.reset(g.V(), -1); // Initialize all colors to -1
+
+        // large undirected graphs are colored by the parallel bfs engine
+        if (g.getGraphType() == GraphType::UNDIRECTED && g.V() > PARALLEL_THRESHOLD)
+            return colorGraphParallel(g, workspace, Parallel::numThreads());
 
         // Start BFS traversal from an arbitrary vertex
         for (size_t v = 0; v < g.V(); ++v) {
             if (colors[v] == -1) {
-                if (!colorGraphBFS(g, colors, v)) {
-                    return "Graph is not bipartite";
+                if (!colorGraphBFS(g, colors, v, workspace.queue)) {
+                    return false;
                 }
             }
         }
-
-        return FindPartition(colors); // Graph is bipartite
+        return true;
     }
 
     /**
@@ -33,30 +51,28 @@ namespace ariel {
      * @param g The graph to be colored.
      * @param colors A vector to store the color of each vertex.
      * @param start The starting vertex for BFS traversal.
+     * @param queue Storage for the BFS queue, its contents are discarded.
      * @return True if the graph is bipartite, false otherwise.
      */
-    bool IsBipartite::colorGraphBFS(const Graph& g, std::vector<int>& colors, size_t start) {
-        std::queue<size_t> q;
-        q.push(start);
+    bool IsBipartite::colorGraphBFS(const Graph& g, StampedArray<int>& colors, size_t start, std::vector<size_t>& queue) {
+        // the queue is read from head instead of popped, so its storage is reused by the next call
+        queue.clear();
+        queue.push_back(start);
         colors[start] = 0; // Color the starting vertex
 
-        while (!q.empty()) {
-            size_t current = q.front();
-            q.pop();
-
-            // Iterate over neighbors of the current vertex
-            for (size_t v = 0; v < g.V(); ++v) {
-                // Check if there is an edge between current and v
-                if (g.getEdgeWeight(current, v) != 0) {
-                    // Check if neighbor v is not colored yet
-                    if (colors[v] == -1) {
-                        // Color the neighbor with a different color than the current vertex
-                        colors[v] = 1 - colors[current];
-                        q.push(v);
-                    } else if (colors[v] == colors[current]) {
-                        // If neighbor has the same color as the current vertex, graph is not bipartite
-                        return false;
-                    }
+        for (size_t head = 0; head < queue.size(); ++head) {
+            size_t current = queue[head];
+
+            // Iterate over neighbors of the current vertex, the cached lists hold the edges in increasing order
+            for (size_t v : g.neighbors(current)) {
+                // Check if neighbor v is not colored yet
+                if (colors[v] == -1) {
+                    // Color the neighbor with a different color than the current vertex
+                    colors[v] = 1 - colors[current];
+                    queue.push_back(v);
+                } else if (colors[v] == colors[current]) {
+                    // If neighbor has the same color as the current vertex, graph is not bipartite
+                    return false;
                 }
             }
         }
@@ -66,12 +82,45 @@ namespace ariel {
 
 
 
+    /**
+     * Colors an undirected graph with the level-synchronous parallel bfs.
+     * every component is colored by the parity of the bfs level of its vertices, then all edges are
+     * checked in parallel, an edge between two vertices of the same color means an odd cycle.
+     * the levels of all the components come from one pass of BfsEngine::componentLevels on the workspace.
+     * @param g The undirected graph to be colored.
+     * @param workspace Scratch buffers, receives the colors, all -1 on entry.
+     * @param threads Number of worker threads.
+     * @return True if the graph is bipartite, false otherwise.
+     */
+    bool IsBipartite::colorGraphParallel(const Graph& g, Workspace &workspace, size_t threads) {
+        BfsEngine::componentLevels(g, threads, workspace);
+        StampedArray<int> &colors = workspace.colors;
+        const StampedArray<int> &levels = workspace.dist;
+        // every entry is written by one worker
+        Parallel::forEach(0, g.V(), threads, [&](size_t, size_t v) {
+            colors[v] = levels[v] % 2;
+        });
+
+        // the workers only read, through the const accessor
+        const StampedArray<int> &colored = colors;
+        std::atomic<bool> bipartite(true);
+        Parallel::forEach(0, g.V(), threads, [&](size_t, size_t u) {
+            if (!bipartite.load(std::memory_order_relaxed))
+                return;
+            for (size_t v : g.neighbors(u)) {
+                if (colored[u] == colored[v])
+                    bipartite.store(false);
+            }
+        });
+        return bipartite.load();
+    }
+
     /**
      * Finds the partitioning of the bipartite graph into two sets.
-     * @param colors A vector containing the color of each vertex.
+     * @param colors The color of each vertex.
      * @return A string representing the bipartite partitioning of the graph.
      */
-    std::string IsBipartite::FindPartition(std::vector<int> &colors) {
+    std::string IsBipartite::FindPartition(const StampedArray<int> &colors) {
         // init A and B
         std::vector<size_t> A, B;
 
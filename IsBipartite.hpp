@@ -5,6 +5,8 @@
 
 #include "Graph.hpp"
 #include "IsConnected.hpp"
+#include "BfsEngine.hpp"
+#include "Workspace.hpp"
 #include <string>
 #include <vector>
 #include <unordered_set>
@@ -13,11 +15,15 @@
 namespace ariel {
     class IsBipartite {
     public:
-        static std::string Execute(const ariel::Graph &g);
+        // the colors and the bfs queue live in workspace, the calling thread's one by default
+        static std::string Execute(const ariel::Graph &g, Workspace &workspace = Workspace::local());
+        // 2-colours the graph into workspace.colors (0 or 1 per vertex), false if the graph is not bipartite
+        static bool colorGraph(const ariel::Graph &g, Workspace &workspace = Workspace::local());
 
     private:
-        static bool  colorGraphBFS(const Graph& g, std::vector<int>& colors, size_t start);
-        static std::string FindPartition(std::vector<int>& colors);
+        static bool  colorGraphBFS(const Graph& g, StampedArray<int>& colors, size_t start, std::vector<size_t>& queue);
+        static bool colorGraphParallel(const Graph& g, Workspace &workspace, size_t threads);
+        static std::string FindPartition(const StampedArray<int>& colors);
     };
 }
 
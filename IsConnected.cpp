@@ -8,10 +8,11 @@ namespace ariel {
     /**
      * Determines whether the graph is connected or not.
      * @param g The graph to check for connectivity.
+     * @param workspace Scratch buffers for the traversals, reused between calls.
      * @return True if the graph is connected, false otherwise.
      * @throws std::runtime_error if encountering an unknown graph type.
      */
-    bool IsConnected::Execute(const ariel::Graph &g) {
+    bool IsConnected::Execute(const ariel::Graph &g, Workspace &workspace) {
         // empty graph
         if(g.isEmpty())
             return "Graph is empty";
@@ -20,11 +21,14 @@ namespace ariel {
         switch (g.getGraphType()) {
             // For directed graph, use specialized function to check connectivity
             case(GraphType::DIRECTED):
-                return isConnectedDirected(g);
+                return isConnectedDirected(g, workspace);
 
                 // For undirected graph, use specialized function to check connectivity
             case(GraphType::UNDIRECTED):
-                return isConnectedUndirected(g);
+                // large graphs are labeled by the multi-threaded components engine
+                if (g.V() > PARALLEL_THRESHOLD)
+                    return ConnectedComponents::countComponents(ConnectedComponents::Execute(g)) == 1;
+                return isConnectedUndirected(g, workspace);
 
                 // Handle the case of encountering an unknown graph type
             default:
@@ -38,18 +42,12 @@ namespace ariel {
       * @param g The undirected graph to check for connectivity.
       * @return True if the undirected graph is connected, false otherwise.
       */
-    bool IsConnected::isConnectedUndirected(const ariel::Graph &g) {
-        // Initialize a vector to track visited vertices during DFS
-        std::vector<bool> visited(g.V(), false);
-
-        // Start DFS from an arbitrary vertex (vertex 0)
-        dfs(g, visited, 0);
-
-        // Check if all vertices were visited during DFS
-        for(size_t v = 0; v < g.V(); ++v)
-            if(!visited[v])
-                return false;
-        return true;
+    bool IsConnected::isConnectedUndirected(const ariel::Graph &g, Workspace &workspace) {
+        // start a new generation of the visited set, no O(V) clear
+        workspace.visited.clear(g.V());
+
+        // Start DFS from an arbitrary vertex (vertex 0), and check if all vertices were visited
+        return dfs(g, workspace.visited, workspace.queue, 0) == g.V();
     }
 
     /**
@@ -59,48 +57,52 @@ namespace ariel {
      * @return True if the directed graph is strongly connected, false otherwise.
      *  took the idea from : https://www.geeksforgeeks.org/check-if-a-directed-graph-is-connected-or-not/
      */
-    bool IsConnected::isConnectedDirected(const ariel::Graph &g) {
-        // Initialize visited arrays for DFS traversal and reverse DFS traversal
-        std::vector<bool> vis1(g.V(), false);
-        std::vector<bool> vis2(g.V(), false);
-
-        // Step 1: Run DFS from a random vertex and mark all visited vertices in vis1
-        dfs(g, vis1, 0);
-        // Check if all vertices are visited in vis1
-        for (bool visited : vis1) {
-            if (!visited)
-                return false; // Not strongly connected
-        }
+    bool IsConnected::isConnectedDirected(const ariel::Graph &g, Workspace &workspace) {
+        VisitedSet &visited = workspace.visited;
 
-        // Step 2: Reverse the direction of all edges in the graph
-        ariel::Graph gReversed = g.getReversedGraph();
+        // Step 1: Run DFS from a random vertex, check if all vertices are visited
+        visited.clear(g.V());
+        if (dfs(g, visited, workspace.queue, 0) != g.V())
+            return false; // Not strongly connected
 
-        // Step 3: Run DFS from the same random vertex in the reversed graph and mark all visited vertices in vis2
-        dfs(gReversed, vis2, 0);
+        // Step 2: Reverse the direction of all edges in the graph, through a view instead of a copy
+        ReversedView<Graph> gReversed(g);
 
-        // Step 4: Check if any vertex is not visited in vis2
-        for (bool visited : vis2) {
-            if (!visited)
-                return false; // Not strongly connected
-        }
-        return true;
+        // Step 3: Run DFS from the same random vertex in the reversed graph on a fresh generation of the set
+        visited.clear(g.V());
+
+        // Step 4: Check if any vertex is not visited
+        return dfs(gReversed, visited, workspace.queue, 0) == g.V();
     }
 
 
     /**
      * Depth-First Search (DFS) traversal of the graph starting from a given vertex.
-     * @param g The graph to perform DFS traversal on.
-     * @param visited A vector indicating whether each vertex has been visited.
+     * runs on an explicit stack, so deep graphs do not overflow the call stack.
+     * @param g The graph or graph view to perform DFS traversal on.
+     * @param visited The vertices visited so far, the traversal adds the vertices it reaches.
+     * @param stack Storage for the DFS stack, its contents are discarded.
      * @param start The starting vertex for DFS traversal.
+     * @return The number of vertices this traversal visited.
      */
-    void IsConnected::dfs(const Graph &g, std::vector<bool>& visited, size_t start) {
-        // Mark the current vertex as visited
-        visited[start] = true;
-
-        // Iterate over all adjacent vertices and recursively visit unvisited vertices
-        for(size_t v = 0; v < g.V(); ++v){
-            if(g.getEdgeWeight(start, v) != 0 && !visited[v])
-                dfs(g, visited, v);
+    template <typename G>
+    size_t IsConnected::dfs(const G &g, VisitedSet& visited, std::vector<size_t>& stack, size_t start) {
+        // Mark the start vertex as visited
+        stack.clear();
+        stack.push_back(start);
+        size_t count = visited.insert(start) ? 1 : 0;
+
+        while (!stack.empty()) {
+            size_t u = stack.back();
+            stack.pop_back();
+            // Iterate over all adjacent vertices and push the unvisited ones
+            g.forEachNeighbor(u, [&](size_t v, int) {
+                if (visited.insert(v)) {
+                    count++;
+                    stack.push_back(v);
+                }
+            });
         }
+        return count;
     }
 }
@@ -5,16 +5,22 @@
 
 #include "DetectCycle.hpp"
 #include "Graph.hpp"
+#include "ConnectedComponents.hpp"
+#include "Workspace.hpp"
+#include "GraphViews.hpp"
 using namespace std;
 
 namespace ariel {
     class IsConnected {
     public:
-            static bool Execute(const ariel::Graph &g);
+            // the visited set and the dfs stack live in workspace, the calling thread's one by default
+            static bool Execute(const ariel::Graph &g, Workspace &workspace = Workspace::local());
     private:
-        static bool isConnectedDirected(const Graph& g);
-        static bool isConnectedUndirected(const Graph& g);
-        static void dfs(const Graph& g, std::vector<bool>& visited , size_t start);
+        static bool isConnectedDirected(const Graph& g, Workspace &workspace);
+        static bool isConnectedUndirected(const Graph& g, Workspace &workspace);
+        // G is a Graph or one of the graph views
+        template <typename G>
+        static size_t dfs(const G& g, VisitedSet& visited, std::vector<size_t>& stack, size_t start);
 
     };
 }
@@ -0,0 +1,179 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "KCore.hpp"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+
+namespace ariel {
+
+    std::vector<size_t> KCore::Execute(const Graph &g, CoreEngine engine, size_t threads) {
+        std::vector<size_t> core, order;
+        peel(g, engine, threads, core, order);
+        return core;
+    }
+
+    std::vector<size_t> KCore::degeneracyOrdering(const Graph &g, CoreEngine engine, size_t threads) {
+        std::vector<size_t> core, order;
+        peel(g, engine, threads, core, order);
+        return order;
+    }
+
+    size_t KCore::degeneracy(const Graph &g) {
+        std::vector<size_t> core = Execute(g);
+        return core.empty() ? 0 : *std::max_element(core.begin(), core.end());
+    }
+
+    /**
+     * Peels the graph with the chosen engine.
+     * @param g The undirected graph.
+     * @param engine The engine, AUTO runs the parallel one on graphs above PARALLEL_THRESHOLD vertices.
+     * @param threads Number of worker threads of the parallel engine.
+     * @param core Receives the core number of every vertex.
+     * @param order Receives the vertices in the order they were peeled.
+     * @throws std::invalid_argument if the graph is directed.
+     */
+    void KCore::peel(const Graph &g, CoreEngine engine, size_t threads, std::vector<size_t> &core,
+                     std::vector<size_t> &order) {
+        if (g.getGraphType() == GraphType::DIRECTED)
+            throw std::invalid_argument("Core decomposition requires an undirected graph");
+        if (engine == CoreEngine::AUTO)
+            engine = g.V() > PARALLEL_THRESHOLD && threads > 1 ? CoreEngine::PARALLEL : CoreEngine::BUCKET;
+        if (engine == CoreEngine::PARALLEL)
+            parallelPeel(g, std::max<size_t>(1, threads), core, order);
+        else
+            bucketPeel(g, core, order);
+    }
+
+    /**
+     * The vertices sit in one array sorted by their current degree, bin[d] being where degree d starts.
+     * the vertex at the front always has the smallest degree, so it is peeled with that degree as its core
+     * number, and every neighbour with a larger degree moves down one bucket by a swap with the first vertex of
+     * its bucket. the array ends up in peeling order.
+     */
+    void KCore::bucketPeel(const Graph &g, std::vector<size_t> &core, std::vector<size_t> &order) {
+        size_t n = g.V();
+        core.assign(n, 0);
+        size_t maxDegree = 0;
+        for (size_t v = 0; v < n; ++v) {
+            core[v] = g.degree(v);
+            maxDegree = std::max(maxDegree, core[v]);
+        }
+
+        // counting sort by degree
+        std::vector<size_t> bin(maxDegree + 1, 0);
+        for (size_t v = 0; v < n; ++v)
+            bin[core[v]]++;
+        for (size_t d = 0, start = 0; d <= maxDegree; ++d) {
+            size_t count = bin[d];
+            bin[d] = start;
+            start += count;
+        }
+        std::vector<size_t> position(n);
+        order.assign(n, 0);
+        for (size_t v = 0; v < n; ++v) {
+            position[v] = bin[core[v]]++;
+            order[position[v]] = v;
+        }
+        for (size_t d = maxDegree; d > 0; --d)
+            bin[d] = bin[d - 1];
+        bin[0] = 0;
+
+        for (size_t i = 0; i < n; ++i) {
+            size_t v = order[i];
+            for (size_t u : g.neighbors(v)) {
+                if (core[u] <= core[v])
+                    continue;
+                size_t degree = core[u];
+                size_t first = order[bin[degree]];
+                if (u != first) {
+                    std::swap(order[position[u]], order[bin[degree]]);
+                    position[first] = position[u];
+                    position[u] = bin[degree];
+                }
+                bin[degree]++;
+                core[u]--;
+            }
+        }
+    }
+
+    /**
+     * Peels level k = 0, 1, 2 ... in rounds: the remaining vertices of degree k are peeled together, split
+     * between the threads, and a neighbour whose degree an atomic decrement brings from k + 1 to k is peeled in
+     * the next round of the same level. the one decrement that sees k + 1 is the only one to claim the vertex,
+     * a decrement that finds the degree already at k is undone. between levels the remaining vertices are
+     * compacted and k jumps to their smallest degree. every level costs the remaining vertices plus the peeled
+     * edges, the rounds of a level append to the order in any interleaving of the threads.
+     */
+    void KCore::parallelPeel(const Graph &g, size_t threads, std::vector<size_t> &core, std::vector<size_t> &order) {
+        size_t n = g.V();
+        core.assign(n, 0);
+        order.clear();
+        order.reserve(n);
+        std::vector<std::atomic<size_t>> degree(n);
+        std::vector<char> peeled(n, 0);
+        std::vector<size_t> remaining(n);
+        for (size_t v = 0; v < n; ++v) {
+            degree[v].store(g.degree(v));
+            remaining[v] = v;
+        }
+
+        std::vector<std::vector<size_t>> buffers(threads);
+        std::vector<size_t> lowest(threads);
+        auto gather = [&](std::vector<size_t> &into) {
+            into.clear();
+            for (std::vector<size_t> &buffer : buffers) {
+                into.insert(into.end(), buffer.begin(), buffer.end());
+                buffer.clear();
+            }
+        };
+
+        std::vector<size_t> frontier;
+        while (true) {
+            // drop the vertices peeled by the last level and find the next one
+            std::fill(lowest.begin(), lowest.end(), std::numeric_limits<size_t>::max());
+            Parallel::forEach(0, remaining.size(), threads, [&](size_t thread, size_t i) {
+                size_t v = remaining[i];
+                if (!peeled[v]) {
+                    buffers[thread].push_back(v);
+                    lowest[thread] = std::min(lowest[thread], degree[v].load());
+                }
+            }, 1024);
+            gather(remaining);
+            if (remaining.empty())
+                break;
+            size_t k = *std::min_element(lowest.begin(), lowest.end());
+
+            Parallel::forEach(0, remaining.size(), threads, [&](size_t thread, size_t i) {
+                size_t v = remaining[i];
+                if (degree[v].load() == k) {
+                    core[v] = k;
+                    peeled[v] = 1;
+                    buffers[thread].push_back(v);
+                }
+            }, 1024);
+            gather(frontier);
+
+            while (!frontier.empty()) {
+                order.insert(order.end(), frontier.begin(), frontier.end());
+                Parallel::forEach(0, frontier.size(), threads, [&](size_t thread, size_t i) {
+                    size_t u = frontier[i];
+                    for (size_t v : g.neighbors(u)) {
+                        if (v == u || degree[v].load() <= k)
+                            continue;
+                        size_t old = degree[v].fetch_sub(1);
+                        if (old == k + 1) {
+                            core[v] = k;
+                            peeled[v] = 1;
+                            buffers[thread].push_back(v);
+                        } else if (old <= k) {
+                            degree[v].fetch_add(1);
+                        }
+                    }
+                }, 16);
+                gather(frontier);
+            }
+        }
+    }
+}
@@ -0,0 +1,44 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef K_CORE_HPP
+#define K_CORE_HPP
+
+#include "Graph.hpp"
+#include "Parallel.hpp"
+#include <vector>
+
+namespace ariel {
+    // peeling engine of the core decomposition, AUTO runs the parallel one on graphs above PARALLEL_THRESHOLD
+    enum class CoreEngine { AUTO, BUCKET, PARALLEL };
+
+    /**
+     * k-core decomposition of an undirected graph: the core number of a vertex is the largest k such that it
+     * belongs to a subgraph where every vertex has at least k neighbours. self loops are ignored.
+     * the vertices in the order they are peeled form a degeneracy ordering, where every vertex has at most its
+     * core number of neighbours after it, so orienting the edges along it bounds every out-degree by the
+     * degeneracy of the graph.
+     */
+    class KCore {
+    public:
+        // core number of every vertex
+        static std::vector<size_t> Execute(const Graph &g, CoreEngine engine = CoreEngine::AUTO,
+                                           size_t threads = Parallel::numThreads());
+        // the vertices in peeling order
+        static std::vector<size_t> degeneracyOrdering(const Graph &g, CoreEngine engine = CoreEngine::AUTO,
+                                                      size_t threads = Parallel::numThreads());
+        // the largest core number, 0 for a graph without edges
+        static size_t degeneracy(const Graph &g);
+
+    private:
+        // fills the core numbers and the peeling order
+        static void peel(const Graph &g, CoreEngine engine, size_t threads, std::vector<size_t> &core,
+                         std::vector<size_t> &order);
+        // Batagelj-Zaversnik: vertices kept sorted by degree in buckets, O(V + E)
+        static void bucketPeel(const Graph &g, std::vector<size_t> &core, std::vector<size_t> &order);
+        // level by level: all the vertices of degree k are peeled at once by the threads, with atomic degrees
+        static void parallelPeel(const Graph &g, size_t threads, std::vector<size_t> &core,
+                                 std::vector<size_t> &order);
+    };
+}
+
+#endif // K_CORE_HPP
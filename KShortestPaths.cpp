@@ -0,0 +1,101 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "KShortestPaths.hpp"
+#include "GraphViews.hpp"
+#include "ShortestPath.hpp"
+#include <set>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+namespace ariel {
+
+    /**
+     * Finds the k shortest loopless paths with Yen's algorithm.
+     * each new path is searched for as a deviation from the last accepted one: for every spur vertex on it the
+     * root before the spur is kept, the root vertices are masked out, and so are the edges leaving the spur that
+     * accepted paths with the same root already use. the lightest of all deviations found so far is accepted next.
+     * @param g The graph in which to find the paths, must not contain negative edges.
+     * @param source The source vertex.
+     * @param dest The destination vertex.
+     * @param k The number of paths wanted.
+     * @param workspace Scratch buffers for the spur searches, reused between calls.
+     * @return The paths as vertex lists in non-decreasing weight, fewer than k if the graph has fewer.
+     *         a vertex has no path to itself, so source == dest gives no paths.
+     * @throws std::invalid_argument if the input is invalid or the graph has negative edges.
+     */
+    std::vector<std::vector<size_t>> KShortestPaths::Execute(const Graph &g, size_t source, size_t dest, size_t k,
+                                                            Workspace &workspace) {
+        if (g.isEmpty() || source >= g.V() || dest >= g.V())
+            throw std::invalid_argument("Invalid input for finding shortest path");
+        if (g.getEdgeNegativity() == EdgeNegativity::NEGATIVE)
+            throw std::invalid_argument("k shortest paths require a graph without negative edges");
+
+        std::vector<std::vector<size_t>> accepted;
+        if (k == 0 || source == dest)
+            return accepted;
+
+        std::vector<bool> keep(g.V(), true);
+        VisitedSet &blockedTargets = workspace.mask;
+        blockedTargets.clear(g.V());
+        std::vector<size_t> path;
+        if (spurSearch(g, source, dest, keep, blockedTargets, workspace, path) == std::numeric_limits<int>::max())
+            return accepted;
+        accepted.push_back(path);
+
+        // deviations found so far, ordered by weight and then by their vertices so ties are deterministic
+        std::set<std::pair<long long, std::vector<size_t>>> candidates;
+        while (accepted.size() < k) {
+            const std::vector<size_t> last = accepted.back();
+            long long rootWeight = 0;
+
+            for (size_t i = 0; i + 1 < last.size(); ++i) {
+                size_t spur = last[i];
+                // the root vertices before the spur may not be visited again
+                if (i > 0)
+                    keep[last[i - 1]] = false;
+                // nor may the spur leave over an edge of an accepted path with the same root
+                blockedTargets.clear(g.V());
+                for (const std::vector<size_t> &other : accepted) {
+                    if (other.size() > i + 1 && std::equal(last.begin(), last.begin() + long(i) + 1, other.begin()))
+                        blockedTargets.insert(other[i + 1]);
+                }
+
+                int spurWeight = spurSearch(g, spur, dest, keep, blockedTargets, workspace, path);
+                if (spurWeight != std::numeric_limits<int>::max()) {
+                    std::vector<size_t> candidate(last.begin(), last.begin() + long(i));
+                    candidate.insert(candidate.end(), path.begin(), path.end());
+                    candidates.insert(std::make_pair(rootWeight + spurWeight, candidate));
+                }
+                rootWeight += g.getEdgeWeight(spur, last[i + 1]);
+            }
+            for (size_t j = 0; j + 1 < last.size(); ++j)
+                keep[last[j]] = true;
+
+            if (candidates.empty())
+                break;
+            accepted.push_back(candidates.begin()->second);
+            candidates.erase(candidates.begin());
+        }
+        return accepted;
+    }
+
+    int KShortestPaths::spurSearch(const Graph &g, size_t spur, size_t dest, const std::vector<bool> &keep,
+                                   const VisitedSet &blockedTargets, Workspace &workspace, std::vector<size_t> &path) {
+        // the filter wraps a named mask view, views only keep a reference to what they wrap
+        VertexMaskView<Graph> unblocked(g, keep);
+        auto view = edgeFilterView(unblocked, [&](size_t u, size_t v, int) {
+            return u != spur || !blockedTargets.contains(v);
+        });
+        ShortestPath::dijkstraTree(view, spur, dest, g.getMaxWeight(), workspace);
+
+        path.clear();
+        if (workspace.dist[dest] == std::numeric_limits<int>::max())
+            return std::numeric_limits<int>::max();
+        for (size_t v = dest; v != spur; v = workspace.predecessors[v])
+            path.push_back(v);
+        path.push_back(spur);
+        std::reverse(path.begin(), path.end());
+        return workspace.dist[dest];
+    }
+}
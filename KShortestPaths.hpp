@@ -0,0 +1,30 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef K_SHORTEST_PATHS_HPP
+#define K_SHORTEST_PATHS_HPP
+
+#include "Graph.hpp"
+#include "Workspace.hpp"
+#include <vector>
+
+namespace ariel {
+    /**
+     * Yen's algorithm for the k shortest loopless paths between two vertices.
+     * every spur search is ShortestPath's Dijkstra on a vertex mask view of the graph with an edge filter on top,
+     * so no modified copy of the graph is ever built.
+     */
+    class KShortestPaths {
+    public:
+        // up to k loopless paths from source to dest, lightest first, the graph must not have negative edges
+        static std::vector<std::vector<size_t>> Execute(const Graph &g, size_t source, size_t dest, size_t k,
+                                                        Workspace &workspace = Workspace::local());
+
+    private:
+        // Dijkstra from spur to dest on g without the vertices outside keep and the edges spur -> blockedTargets,
+        // fills path and returns its weight, INT_MAX if dest can not be reached
+        static int spurSearch(const Graph &g, size_t spur, size_t dest, const std::vector<bool> &keep,
+                              const VisitedSet &blockedTargets, Workspace &workspace, std::vector<size_t> &path);
+    };
+}
+
+#endif // K_SHORTEST_PATHS_HPP
@@ -0,0 +1,78 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "Landmarks.hpp"
+#include "ShortestPath.hpp"
+
+namespace ariel {
+
+    /**
+     * Builds the landmark tables of the graph.
+     * the first landmark is vertex 0, every next one is the vertex farthest from the landmarks chosen so far,
+     * which spreads them over the border of the graph where they give the tightest bounds.
+     * @param g The graph, must not contain negative edges.
+     * @param count The number of landmarks, capped at the number of vertices.
+     * @throws std::invalid_argument if the graph has negative edges.
+     */
+    Landmarks::Landmarks(const Graph &g, size_t count) : numVertices(g.V()) {
+        if (g.getEdgeNegativity() == EdgeNegativity::NEGATIVE)
+            throw std::invalid_argument("Landmarks require a graph without negative edges");
+        if (g.isEmpty())
+            return;
+
+        const int INF = std::numeric_limits<int>::max();
+        count = std::min(count, g.V());
+        // distances to the nearest chosen landmark, used for farthest selection
+        std::vector<int> nearest(g.V(), INF);
+        // distances towards a landmark are distances from it in the reversed graph
+        Graph reversed;
+        if (g.getGraphType() == GraphType::DIRECTED)
+            reversed = g.getReversedGraph();
+
+        size_t next = 0;
+        for (size_t i = 0; i < count; ++i) {
+            landmarks.push_back(next);
+            fromLandmark.push_back(ShortestPath::dijkstraDistances(g, next));
+            if (g.getGraphType() == GraphType::DIRECTED)
+                toLandmark.push_back(ShortestPath::dijkstraDistances(reversed, next));
+            else
+                toLandmark.push_back(fromLandmark.back());
+
+            // the next landmark is the reachable vertex farthest from all landmarks so far
+            int farthest = 0;
+            for (size_t v = 0; v < g.V(); ++v) {
+                nearest[v] = std::min(nearest[v], fromLandmark.back()[v]);
+                if (nearest[v] != INF && nearest[v] > farthest) {
+                    farthest = nearest[v];
+                    next = v;
+                }
+            }
+            // every reachable vertex is already a landmark
+            if (farthest == 0)
+                break;
+        }
+    }
+
+    int Landmarks::lowerBound(size_t v, size_t target) const {
+        const int INF = std::numeric_limits<int>::max();
+        int bound = 0;
+        for (size_t i = 0; i < landmarks.size(); ++i) {
+            // d(v, t) >= d(L, t) - d(L, v)
+            int fromT = fromLandmark[i][target], fromV = fromLandmark[i][v];
+            if (fromT != INF && fromV != INF)
+                bound = std::max(bound, fromT - fromV);
+            // d(v, t) >= d(v, L) - d(t, L)
+            int toV = toLandmark[i][v], toT = toLandmark[i][target];
+            if (toV != INF && toT != INF)
+                bound = std::max(bound, toV - toT);
+        }
+        return bound;
+    }
+
+    const std::vector<size_t> &Landmarks::getLandmarks() const {
+        return landmarks;
+    }
+
+    size_t Landmarks::V() const {
+        return numVertices;
+    }
+}
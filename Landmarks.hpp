@@ -0,0 +1,32 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef LANDMARKS_HPP
+#define LANDMARKS_HPP
+
+#include "Graph.hpp"
+#include <vector>
+
+namespace ariel {
+    /**
+     * ALT preprocessing: shortest distances from and to a few landmark vertices.
+     * build it once per graph and reuse it for every A* query on that graph.
+     */
+    class Landmarks {
+    public:
+        // picks `count` landmarks by farthest selection, the graph must not have negative edges
+        explicit Landmarks(const Graph &g, size_t count = 4);
+
+        // lower bound on the distance from v to target derived from the triangle inequality
+        [[nodiscard]] int lowerBound(size_t v, size_t target) const;
+        [[nodiscard]] const std::vector<size_t> &getLandmarks() const;
+        [[nodiscard]] size_t V() const;
+
+    private:
+        size_t numVertices;
+        std::vector<size_t> landmarks;
+        std::vector<std::vector<int>> fromLandmark; // fromLandmark[i][v] = d(landmark i, v)
+        std::vector<std::vector<int>> toLandmark;   // toLandmark[i][v] = d(v, landmark i)
+    };
+}
+
+#endif // LANDMARKS_HPP
@@ -0,0 +1,94 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "LocalSearch.hpp"
+#include <limits>
+#include <stdexcept>
+
+namespace ariel {
+
+    /**
+     * Finds the k-hop neighbourhood of a vertex with a breadth first search that does not expand the last level.
+     * @param g The graph to search, edge weights are ignored.
+     * @param source The vertex to start from.
+     * @param hops The largest number of edges from the source.
+     * @param workspace Scratch buffers for the search, reused between calls.
+     * @return The reached vertices with their number of edges from the source, in bfs order.
+     * @throws std::invalid_argument if the graph is empty or the source is out of range.
+     */
+    std::vector<std::pair<size_t, int>> LocalSearch::withinHops(const Graph &g, size_t source, size_t hops,
+                                                                Workspace &workspace) {
+        checkInput(g, source);
+        // the stamped distances double as the visited marks
+        StampedArray<int> &dist = workspace.dist;
+        dist.reset(g.V(), std::numeric_limits<int>::max());
+        std::vector<size_t> &queue = workspace.queue;
+        queue.clear();
+        queue.push_back(source);
+        dist[source] = 0;
+
+        std::vector<std::pair<size_t, int>> result;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            size_t u = queue[head];
+            result.emplace_back(u, dist[u]);
+            // vertices on the last level are reported but not expanded
+            if (size_t(dist[u]) >= hops)
+                continue;
+            for (size_t v : g.neighbors(u)) {
+                if (dist[v] == std::numeric_limits<int>::max()) {
+                    dist[v] = dist[u] + 1;
+                    queue.push_back(v);
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Finds the vertices within a distance of a vertex with Dijkstra's algorithm that stops at the limit.
+     * tentative distances above the limit are never queued, so the search only touches the ball around the source
+     * and the edges leaving it.
+     * @param g The graph to search, must not contain negative edges.
+     * @param source The vertex to start from.
+     * @param limit The largest distance from the source.
+     * @param workspace Scratch buffers for the search, reused between calls.
+     * @return The reached vertices with their distance from the source, in the order they were settled.
+     * @throws std::invalid_argument if the input is invalid or the graph has negative edges.
+     */
+    std::vector<std::pair<size_t, int>> LocalSearch::withinDistance(const Graph &g, size_t source, int limit,
+                                                                    Workspace &workspace) {
+        checkInput(g, source);
+        if (g.getEdgeNegativity() == EdgeNegativity::NEGATIVE)
+            throw std::invalid_argument("Distance-limited search requires a graph without negative edges");
+        if (limit < 0)
+            return {};
+
+        StampedArray<int> &dist = workspace.dist;
+        dist.reset(g.V(), std::numeric_limits<int>::max());
+        IndexedDaryHeap<4> &queue = workspace.heap;
+        queue.reset(g.V(), g.getMaxWeight());
+        dist[source] = 0;
+        queue.push(source, 0);
+
+        std::vector<std::pair<size_t, int>> result;
+        while (!queue.empty()) {
+            std::pair<int, size_t> top = queue.pop();
+            size_t u = top.second;
+            result.emplace_back(u, top.first);
+
+            for (size_t v : g.neighbors(u)) {
+                // computed wide, a limit close to INT_MAX must not overflow
+                long long candidate = static_cast<long long>(top.first) + g.getEdgeWeight(u, v);
+                if (candidate <= limit && candidate < dist[v]) {
+                    dist[v] = static_cast<int>(candidate);
+                    queue.push(v, dist[v]);
+                }
+            }
+        }
+        return result;
+    }
+
+    void LocalSearch::checkInput(const Graph &g, size_t source) {
+        if (g.isEmpty() || source >= g.V())
+            throw std::invalid_argument("Invalid input for local search");
+    }
+}
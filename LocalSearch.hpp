@@ -0,0 +1,33 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef LOCAL_SEARCH_HPP
+#define LOCAL_SEARCH_HPP
+
+#include "Graph.hpp"
+#include "Workspace.hpp"
+#include <vector>
+#include <utility>
+
+namespace ariel {
+    /**
+     * Bounded searches around a source vertex.
+     * the traversals stop expanding at the limit and walk the cached adjacency lists on the stamped arrays of a
+     * workspace, so their cost follows the size of the neighbourhood and not the size of the graph.
+     * results are (vertex, distance) pairs in non-decreasing distance, the source first.
+     */
+    class LocalSearch {
+    public:
+        // every vertex at most hops edges away from source
+        static std::vector<std::pair<size_t, int>> withinHops(const Graph &g, size_t source, size_t hops,
+                                                              Workspace &workspace = Workspace::local());
+
+        // every vertex whose shortest path from source weighs at most limit, the graph must not have negative edges
+        static std::vector<std::pair<size_t, int>> withinDistance(const Graph &g, size_t source, int limit,
+                                                                  Workspace &workspace = Workspace::local());
+
+    private:
+        static void checkInput(const Graph &g, size_t source);
+    };
+}
+
+#endif // LOCAL_SEARCH_HPP
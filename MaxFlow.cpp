@@ -0,0 +1,404 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "MaxFlow.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace ariel {
+
+    /**
+     * Builds the residual network of the graph, one pair of opposite arcs per edge.
+     * a directed edge u->v of weight c gets the arcs u->v of capacity c and v->u of capacity 0,
+     * an undirected edge gets capacity c in both arcs. self loops never carry flow and are left out.
+     * @param g The capacity graph.
+     * @throws std::invalid_argument if the graph has negative edges.
+     */
+    MaxFlow::MaxFlow(const Graph &g)
+            : numVertices(g.V()), source(0), sink(0), flowValue(0), first(g.V() + 1, 0),
+              height(g.V(), 0), current(g.V(), 0), excess(g.V(), 0), buckets(2 * g.V()), count(g.V(), 0) {
+        if (g.getEdgeNegativity() == EdgeNegativity::NEGATIVE)
+            throw std::invalid_argument("Maximum flow requires a graph without negative capacities");
+
+        size_t n = numVertices;
+        bool undirected = g.getGraphType() == GraphType::UNDIRECTED;
+        // the first pass counts the arcs of every vertex, the second one places them
+        std::vector<size_t> next;
+        for (int pass = 0; pass < 2; ++pass) {
+            if (pass == 1) {
+                for (size_t u = 0; u < n; ++u)
+                    first[u + 1] += first[u];
+                arcs.resize(first[n]);
+                next.assign(first.begin(), first.end() - 1);
+            }
+            for (size_t u = 0; u < n; ++u) {
+                for (size_t v : g.neighbors(u)) {
+                    if (u == v || (undirected && v < u))
+                        continue;
+                    if (pass == 0) {
+                        first[u + 1]++;
+                        first[v + 1]++;
+                        continue;
+                    }
+                    long long capacity = g.getEdgeWeight(u, v);
+                    size_t forward = next[u]++;
+                    size_t backward = next[v]++;
+                    arcs[forward] = Arc{v, backward, capacity, capacity};
+                    arcs[backward] = Arc{u, forward, undirected ? capacity : 0, undirected ? capacity : 0};
+                }
+            }
+        }
+        queue.reserve(n);
+    }
+
+    /**
+     * Computes a maximum flow from source to sink.
+     * the residual capacities are reset in place, nothing is allocated.
+     * AUTO runs Dinic's algorithm on unit capacities, where it takes O(E * sqrt(V)),
+     * and push-relabel on weighted graphs.
+     * @param s The source vertex.
+     * @param t The sink vertex.
+     * @param engine The algorithm to use.
+     * @return The value of the maximum flow.
+     * @throws std::invalid_argument if a vertex is out of range or source and sink are the same vertex.
+     */
+    long long MaxFlow::Execute(size_t s, size_t t, FlowEngine engine) {
+        checkInput(s, t);
+        source = s;
+        sink = t;
+        bool unitCapacities = true;
+        for (Arc &arc : arcs) {
+            arc.residual = arc.capacity;
+            unitCapacities = unitCapacities && arc.capacity <= 1;
+        }
+
+        if (engine == FlowEngine::AUTO)
+            engine = unitCapacities ? FlowEngine::DINIC : FlowEngine::PUSH_RELABEL;
+        flowValue = engine == FlowEngine::DINIC ? dinic() : pushRelabel();
+        return flowValue;
+    }
+
+    long long MaxFlow::value() const {
+        return flowValue;
+    }
+
+    long long MaxFlow::flow(size_t u, size_t v) const {
+        if (u >= numVertices || v >= numVertices)
+            throw std::invalid_argument("Invalid vertex");
+        long long sent = 0;
+        for (size_t a = first[u]; a < first[u + 1]; ++a) {
+            if (arcs[a].head == v && arcs[a].capacity > arcs[a].residual)
+                sent += arcs[a].capacity - arcs[a].residual;
+        }
+        return sent;
+    }
+
+    /**
+     * The source side of a minimum cut: the vertices still reachable from the source in the residual network.
+     * @return The vertices of the source side in increasing order.
+     */
+    std::vector<size_t> MaxFlow::minCutSide() const {
+        std::vector<bool> reached(numVertices, false);
+        std::vector<size_t> stack;
+        if (numVertices > 0) {
+            reached[source] = true;
+            stack.push_back(source);
+        }
+        while (!stack.empty()) {
+            size_t u = stack.back();
+            stack.pop_back();
+            for (size_t a = first[u]; a < first[u + 1]; ++a) {
+                if (arcs[a].residual > 0 && !reached[arcs[a].head]) {
+                    reached[arcs[a].head] = true;
+                    stack.push_back(arcs[a].head);
+                }
+            }
+        }
+
+        std::vector<size_t> side;
+        for (size_t v = 0; v < numVertices; ++v) {
+            if (reached[v])
+                side.push_back(v);
+        }
+        return side;
+    }
+
+    std::vector<std::pair<size_t, size_t>> MaxFlow::minCutEdges() const {
+        std::vector<bool> inSide(numVertices, false);
+        for (size_t v : minCutSide())
+            inSide[v] = true;
+
+        std::vector<std::pair<size_t, size_t>> cut;
+        for (size_t u = 0; u < numVertices; ++u) {
+            if (!inSide[u])
+                continue;
+            for (size_t a = first[u]; a < first[u + 1]; ++a) {
+                if (arcs[a].capacity > 0 && !inSide[arcs[a].head])
+                    cut.emplace_back(u, arcs[a].head);
+            }
+        }
+        std::sort(cut.begin(), cut.end());
+        return cut;
+    }
+
+    std::string MaxFlow::toString() const {
+        std::string result = "Maximum flow from " + std::to_string(source) + " to " + std::to_string(sink) +
+                             " is " + std::to_string(flowValue) + ", minimum cut:";
+        for (const std::pair<size_t, size_t> &edge : minCutEdges())
+            result += " (" + std::to_string(edge.first) + "," + std::to_string(edge.second) + ")";
+        return result;
+    }
+
+    size_t MaxFlow::V() const {
+        return numVertices;
+    }
+
+    void MaxFlow::checkInput(size_t s, size_t t) const {
+        if (s >= numVertices || t >= numVertices)
+            throw std::invalid_argument("Invalid source or sink vertex");
+        if (s == t)
+            throw std::invalid_argument("Source and sink must be different vertices");
+    }
+
+    size_t MaxFlow::tail(size_t arc) const {
+        return arcs[arcs[arc].rev].head;
+    }
+
+    long long MaxFlow::dinic() {
+        long long total = 0;
+        while (buildLevels())
+            total += blockingFlow();
+        return total;
+    }
+
+    /**
+     * BFS levels from the source over the arcs with residual capacity, V marks the unreached vertices.
+     * the search stops at the level of the sink, deeper vertices cannot be on a shortest augmenting path.
+     * @return True if the sink is reachable.
+     */
+    bool MaxFlow::buildLevels() {
+        std::fill(height.begin(), height.end(), numVertices);
+        height[source] = 0;
+        queue.clear();
+        queue.push_back(source);
+        for (size_t head = 0; head < queue.size(); ++head) {
+            size_t u = queue[head];
+            if (height[u] >= height[sink])
+                break;
+            for (size_t a = first[u]; a < first[u + 1]; ++a) {
+                if (arcs[a].residual > 0 && height[arcs[a].head] == numVertices) {
+                    height[arcs[a].head] = height[u] + 1;
+                    queue.push_back(arcs[a].head);
+                }
+            }
+        }
+        return height[sink] != numVertices;
+    }
+
+    /**
+     * A blocking flow of the level graph, found with an explicit path instead of recursion.
+     * the current arc of every vertex only moves forward, an arc is passed once it is saturated or leads to a
+     * vertex with no way on, so the whole phase takes O(V * E).
+     * @return The flow added in this phase.
+     */
+    long long MaxFlow::blockingFlow() {
+        for (size_t u = 0; u < numVertices; ++u)
+            current[u] = first[u];
+
+        long long total = 0;
+        std::vector<size_t> &path = queue; // the arcs from the source to u
+        path.clear();
+        size_t u = source;
+        while (true) {
+            if (u == sink) {
+                long long push = std::numeric_limits<long long>::max();
+                for (size_t a : path)
+                    push = std::min(push, arcs[a].residual);
+                // augment and retreat to the tail of the first saturated arc
+                size_t keep = path.size();
+                for (size_t i = 0; i < path.size(); ++i) {
+                    Arc &arc = arcs[path[i]];
+                    arc.residual -= push;
+                    arcs[arc.rev].residual += push;
+                    if (arc.residual == 0 && keep == path.size())
+                        keep = i;
+                }
+                total += push;
+                path.resize(keep);
+                u = path.empty() ? source : arcs[path.back()].head;
+                continue;
+            }
+
+            // advance along the next admissible arc of u
+            size_t end = first[u + 1];
+            while (current[u] < end && (arcs[current[u]].residual == 0 ||
+                                        height[arcs[current[u]].head] != height[u] + 1))
+                ++current[u];
+            if (current[u] < end) {
+                path.push_back(current[u]);
+                u = arcs[current[u]].head;
+                continue;
+            }
+
+            // u is a dead end for this phase, retreat and pass the arc that led to it
+            if (u == source)
+                break;
+            u = tail(path.back());
+            path.pop_back();
+            ++current[u];
+        }
+        return total;
+    }
+
+    /**
+     * Highest-label push-relabel.
+     * the first phase moves excess towards the sink until no vertex below label V holds excess, which gives the
+     * flow value and the minimum cut. the second phase returns the remaining excess to the source so the arcs hold
+     * a valid flow. labels are recomputed by a backward BFS every O(V + E) work, and when no vertex is left with
+     * some label the vertices above it are cut off from the sink (the gap heuristic).
+     * @return The value of the maximum flow.
+     */
+    long long MaxFlow::pushRelabel() {
+        std::fill(excess.begin(), excess.end(), 0);
+        for (size_t a = first[source]; a < first[source + 1]; ++a) {
+            Arc &arc = arcs[a];
+            if (arc.residual == 0)
+                continue;
+            excess[arc.head] += arc.residual;
+            excess[source] -= arc.residual;
+            arcs[arc.rev].residual += arc.residual;
+            arc.residual = 0;
+        }
+
+        runActive(numVertices, true);
+        runActive(2 * numVertices, false);
+        return excess[sink];
+    }
+
+    /**
+     * Labels every vertex with its distance to target over the arcs with residual capacity, plus offset.
+     * the source and the sink keep their fixed labels (V and 0), the current arcs start over.
+     */
+    void MaxFlow::globalRelabel(size_t target, size_t offset, size_t unreached) {
+        std::fill(height.begin(), height.end(), unreached);
+        std::fill(count.begin(), count.end(), 0);
+        height[target] = offset;
+        queue.clear();
+        queue.push_back(target);
+        for (size_t head = 0; head < queue.size(); ++head) {
+            size_t v = queue[head];
+            for (size_t a = first[v]; a < first[v + 1]; ++a) {
+                size_t u = arcs[a].head;
+                // u reaches v if the opposite arc u->v has residual capacity
+                if (arcs[arcs[a].rev].residual > 0 && height[u] == unreached && u != source && u != sink) {
+                    height[u] = height[v] + 1;
+                    queue.push_back(u);
+                }
+            }
+        }
+        height[source] = numVertices;
+        height[sink] = 0;
+
+        for (size_t v = 0; v < numVertices; ++v) {
+            current[v] = first[v];
+            if (height[v] < numVertices)
+                count[height[v]]++;
+        }
+    }
+
+    void MaxFlow::runActive(size_t limit, bool gaps) {
+        size_t target = gaps ? sink : source;
+        size_t offset = gaps ? 0 : numVertices;
+        size_t relabelWork = 6 * numVertices + arcs.size();
+        size_t work = relabelWork; // forces the first global relabel
+
+        size_t top = 0; // buckets at or above top are empty
+        while (true) {
+            if (work >= relabelWork) {
+                globalRelabel(target, offset, limit);
+                for (std::vector<size_t> &bucket : buckets)
+                    bucket.clear();
+                for (size_t v = 0; v < numVertices; ++v) {
+                    if (v != source && v != sink && excess[v] > 0 && height[v] < limit)
+                        buckets[height[v]].push_back(v);
+                }
+                top = limit;
+                work = 0;
+            }
+
+            while (top > 0 && buckets[top - 1].empty())
+                --top;
+            if (top == 0)
+                break;
+            size_t u = buckets[top - 1].back();
+            buckets[top - 1].pop_back();
+            // entries of vertices relabelled by a gap are left behind
+            if (excess[u] == 0 || height[u] != top - 1)
+                continue;
+
+            discharge(u, limit, gaps, work);
+            // a relabelled u may have pushed to vertices above the old top
+            top = std::max(top, std::min(height[u] + 1, limit));
+            if (excess[u] > 0 && height[u] < limit)
+                buckets[height[u]].push_back(u);
+        }
+    }
+
+    void MaxFlow::discharge(size_t u, size_t limit, bool gaps, size_t &work) {
+        while (excess[u] > 0) {
+            if (current[u] == first[u + 1]) {
+                // relabel: one above the lowest neighbour over a residual arc
+                size_t lowest = limit;
+                for (size_t a = first[u]; a < first[u + 1]; ++a) {
+                    if (arcs[a].residual > 0)
+                        lowest = std::min(lowest, height[arcs[a].head]);
+                }
+                work += first[u + 1] - first[u] + 12;
+                size_t label = std::min(lowest + 1, limit);
+                current[u] = first[u];
+                if (gaps && height[u] < numVertices) {
+                    // u leaves its label before the gap check, it is lifted with the others
+                    if (--count[height[u]] == 0) {
+                        relabelGap(height[u]);
+                        label = numVertices;
+                    } else if (label < numVertices) {
+                        count[label]++;
+                    }
+                }
+                height[u] = label;
+                if (height[u] >= limit)
+                    return;
+                continue;
+            }
+
+            Arc &arc = arcs[current[u]];
+            if (arc.residual > 0 && height[u] == height[arc.head] + 1) {
+                long long push = std::min(excess[u], arc.residual);
+                activate(arc.head);
+                arc.residual -= push;
+                arcs[arc.rev].residual += push;
+                excess[u] -= push;
+                excess[arc.head] += push;
+            } else {
+                ++current[u];
+            }
+        }
+    }
+
+    /**
+     * No vertex has label gap any more, so the vertices above it cannot reach the sink: lift them to V.
+     */
+    void MaxFlow::relabelGap(size_t gap) {
+        for (size_t v = 0; v < numVertices; ++v) {
+            if (height[v] > gap && height[v] < numVertices) {
+                count[height[v]]--;
+                height[v] = numVertices;
+            }
+        }
+    }
+
+    void MaxFlow::activate(size_t v) {
+        if (v != source && v != sink && excess[v] == 0)
+            buckets[height[v]].push_back(v);
+    }
+}
@@ -0,0 +1,87 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef MAX_FLOW_HPP
+#define MAX_FLOW_HPP
+
+#include "Graph.hpp"
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace ariel {
+    // algorithm for the maximum flow, AUTO picks one from the capacities
+    enum class FlowEngine { AUTO, DINIC, PUSH_RELABEL };
+
+    /**
+     * Maximum s-t flow and minimum cut, the edge weights of the graph are the capacities.
+     * the residual network is built once per graph and every run resets it in place, so the object can answer
+     * many (source, sink) queries without copying the matrix or allocating.
+     * an undirected edge can carry its capacity in either direction.
+     */
+    class MaxFlow {
+    public:
+        // builds the residual network, the graph must not have negative edges
+        explicit MaxFlow(const Graph &g);
+
+        // value of a maximum flow from source to sink, the flow itself is kept until the next run
+        long long Execute(size_t source, size_t sink, FlowEngine engine = FlowEngine::AUTO);
+
+        // the following describe the last run
+        [[nodiscard]] long long value() const;
+        // flow sent over the edge u->v, 0 if there is no such edge
+        [[nodiscard]] long long flow(size_t u, size_t v) const;
+        // the vertices on the source side of a minimum cut, in increasing order
+        [[nodiscard]] std::vector<size_t> minCutSide() const;
+        // the edges (u, v) of a minimum cut, u on the source side, sorted
+        [[nodiscard]] std::vector<std::pair<size_t, size_t>> minCutEdges() const;
+        // the flow value followed by the minimum cut edges
+        [[nodiscard]] std::string toString() const;
+
+        [[nodiscard]] size_t V() const;
+
+    private:
+        // an arc of the residual network, arc rev is the opposite arc of the same edge
+        struct Arc {
+            size_t head;
+            size_t rev;
+            long long capacity;
+            long long residual;
+        };
+
+        size_t numVertices;
+        size_t source;
+        size_t sink;
+        long long flowValue;
+        std::vector<size_t> first; // the arcs of u are first[u] .. first[u + 1] - 1, sorted by head
+        std::vector<Arc> arcs;
+
+        // scratch arrays of the engines, sized once in the constructor
+        std::vector<size_t> height; // BFS level for Dinic, label for push-relabel
+        std::vector<size_t> current; // next arc to scan of every vertex
+        std::vector<long long> excess;
+        std::vector<size_t> queue;
+        std::vector<std::vector<size_t>> buckets; // active vertices by label
+        std::vector<size_t> count; // number of vertices with every label below V, for the gap heuristic
+
+        void checkInput(size_t s, size_t t) const;
+        [[nodiscard]] size_t tail(size_t arc) const;
+
+        // Dinic's algorithm: blocking flows on the BFS level graph
+        long long dinic();
+        bool buildLevels();
+        long long blockingFlow();
+
+        // highest-label push-relabel with the gap and global relabelling heuristics
+        long long pushRelabel();
+        // labels every vertex with its residual distance to target plus offset, unreached vertices get `unreached`
+        void globalRelabel(size_t target, size_t offset, size_t unreached);
+        // pushes the excess of u along admissible arcs, relabelling u when none is left
+        void discharge(size_t u, size_t limit, bool gaps, size_t &work);
+        void relabelGap(size_t gap);
+        void activate(size_t v);
+        // moves excess between the active vertices with a label below limit, highest label first
+        void runActive(size_t limit, bool gaps);
+    };
+}
+
+#endif // MAX_FLOW_HPP
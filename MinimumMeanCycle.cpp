@@ -0,0 +1,264 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "MinimumMeanCycle.hpp"
+#include <limits>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace ariel {
+
+    /**
+     * Finds a minimum mean cycle with Howard's algorithm.
+     * @param g The graph to search.
+     * @return A string with the cycle and its total weight and length, or a message if the graph has no cycle.
+     */
+    std::string MinimumMeanCycle::Execute(const Graph &g) {
+        std::vector<size_t> cycle = howard(g);
+        if (cycle.empty())
+            return "No cycle found in the graph";
+
+        long long weight = 0;
+        std::string result = "Minimum mean cycle found: ";
+        for (size_t i = 0; i < cycle.size(); ++i) {
+            weight += g.getEdgeWeight(cycle[i], cycle[(i + 1) % cycle.size()]);
+            result += std::to_string(cycle[i]) + " -> ";
+        }
+        return result + std::to_string(cycle[0]) + " (total weight " + std::to_string(weight) + " over " +
+               std::to_string(cycle.size()) + " edges)";
+    }
+
+    /**
+     * Howard's policy iteration for the minimum mean cycle.
+     * every vertex follows one policy edge, so the policy graph is a set of cycles with trees hanging off them.
+     * each vertex gets the mean eta of the cycle its policy leads to and a potential x relative to that cycle,
+     * then every vertex switches to the out-edge leading to a smaller eta, or if there is none to a smaller
+     * potential. when no vertex can improve, the best cycle of the policy graph is a minimum mean cycle.
+     * a cycle found again keeps the potential of its first visited vertex from the previous policy instead of
+     * starting it at 0, so potentials measured against two cycles of equal mean stay comparable from one policy
+     * to the next and a vertex cannot switch back and forth between them.
+     * the number of iterations is small in practice, each one costs O(V + E).
+     * @param g The graph to search.
+     * @param maxIterations Limit on the number of policies, Karp's algorithm gives the cycle past it.
+     * @return The vertices of a minimum mean cycle in edge order starting from its smallest vertex, empty if
+     *         the graph has no cycle.
+     */
+    std::vector<size_t> MinimumMeanCycle::howard(const Graph &g, size_t maxIterations) {
+        const long double EPSILON = 1e-9L;
+        size_t n = g.V();
+        std::vector<bool> alive = cyclicPart(g);
+
+        // start from the lightest out-edge of every vertex
+        std::vector<size_t> policy(n, n);
+        for (size_t u = 0; u < n; ++u) {
+            if (!alive[u])
+                continue;
+            for (size_t v : g.neighbors(u)) {
+                if (alive[v] && (policy[u] == n || g.getEdgeWeight(u, v) < g.getEdgeWeight(u, policy[u])))
+                    policy[u] = v;
+            }
+        }
+
+        std::vector<long double> eta(n, 0), x(n, 0);
+        std::vector<int> state(n);
+        std::vector<size_t> path, best;
+        for (size_t iteration = 0;; ++iteration) {
+            if (iteration == maxIterations)
+                return karpCycle(g);
+
+            // evaluate the policy: the cycles it closes, and eta and x for every vertex
+            std::fill(state.begin(), state.end(), 0); // 0 new, 1 on the current walk, 2 evaluated
+            long double bestMean = std::numeric_limits<long double>::infinity();
+            best.clear();
+            for (size_t start = 0; start < n; ++start) {
+                if (!alive[start] || state[start] != 0)
+                    continue;
+                path.clear();
+                size_t u = start;
+                while (state[u] == 0) {
+                    state[u] = 1;
+                    path.push_back(u);
+                    u = policy[u];
+                }
+
+                size_t tail = path.size();
+                if (state[u] == 1) {
+                    // the walk closed a new cycle starting at u
+                    size_t first = size_t(std::find(path.begin(), path.end(), u) - path.begin());
+                    long long weight = 0;
+                    for (size_t i = first; i < path.size(); ++i)
+                        weight += g.getEdgeWeight(path[i], policy[path[i]]);
+                    long double cycleMean = static_cast<long double>(weight) / static_cast<long double>(path.size() - first);
+
+                    // x[u] keeps its value from the previous policy
+                    eta[u] = cycleMean;
+                    state[u] = 2;
+                    for (size_t i = path.size() - 1; i > first; --i) {
+                        size_t v = path[i];
+                        eta[v] = cycleMean;
+                        x[v] = g.getEdgeWeight(v, policy[v]) - cycleMean + x[policy[v]];
+                        state[v] = 2;
+                    }
+                    if (cycleMean < bestMean) {
+                        bestMean = cycleMean;
+                        best.assign(path.begin() + long(first), path.end());
+                    }
+                    tail = first;
+                }
+                // the rest of the walk leads into an evaluated vertex
+                for (size_t i = tail; i-- > 0;) {
+                    size_t v = path[i];
+                    eta[v] = eta[policy[v]];
+                    x[v] = g.getEdgeWeight(v, policy[v]) - eta[v] + x[policy[v]];
+                    state[v] = 2;
+                }
+            }
+
+            // improve the policy, a smaller eta first
+            bool changed = false;
+            for (size_t u = 0; u < n; ++u) {
+                if (!alive[u])
+                    continue;
+                for (size_t v : g.neighbors(u)) {
+                    if (alive[v] && eta[v] < eta[policy[u]] - EPSILON) {
+                        policy[u] = v;
+                        changed = true;
+                    }
+                }
+            }
+            // then a smaller potential among the edges that keep eta
+            if (!changed) {
+                for (size_t u = 0; u < n; ++u) {
+                    if (!alive[u])
+                        continue;
+                    for (size_t v : g.neighbors(u)) {
+                        if (!alive[v] || std::fabs(eta[v] - eta[u]) > EPSILON)
+                            continue;
+                        long double through = g.getEdgeWeight(u, v) - eta[u] + x[v];
+                        long double current = g.getEdgeWeight(u, policy[u]) - eta[u] + x[policy[u]];
+                        if (through < current - EPSILON) {
+                            policy[u] = v;
+                            changed = true;
+                        }
+                    }
+                }
+            }
+            if (!changed)
+                break;
+        }
+
+        // start from the smallest vertex, so the same cycle always reads the same
+        if (!best.empty())
+            std::rotate(best.begin(), std::min_element(best.begin(), best.end()), best.end());
+        return best;
+    }
+
+    /**
+     * Karp's algorithm for the minimum mean.
+     * D[k][v] is the lightest walk of exactly k edges ending at v from any vertex, and the minimum mean is
+     * min over v of max over k of (D[n][v] - D[k][v]) / (n - k).
+     * @param g The graph to search.
+     * @return The minimum mean edge weight of a cycle, +infinity if the graph has no cycle.
+     */
+    double MinimumMeanCycle::karp(const Graph &g) {
+        std::vector<std::vector<long long>> walk;
+        std::vector<std::vector<size_t>> from;
+        size_t argmin;
+        return karpTable(g, walk, from, argmin);
+    }
+
+    double MinimumMeanCycle::karpTable(const Graph &g, std::vector<std::vector<long long>> &walk,
+                                       std::vector<std::vector<size_t>> &from, size_t &argmin) {
+        const long long INF = std::numeric_limits<long long>::max() / 4;
+        size_t n = g.V();
+        walk.assign(n + 1, std::vector<long long>(n, INF));
+        from.assign(n + 1, std::vector<size_t>(n, n));
+        std::fill(walk[0].begin(), walk[0].end(), 0);
+        for (size_t k = 1; k <= n; ++k) {
+            for (size_t u = 0; u < n; ++u) {
+                if (walk[k - 1][u] == INF)
+                    continue;
+                for (size_t v : g.neighbors(u)) {
+                    if (walk[k - 1][u] + g.getEdgeWeight(u, v) < walk[k][v]) {
+                        walk[k][v] = walk[k - 1][u] + g.getEdgeWeight(u, v);
+                        from[k][v] = u;
+                    }
+                }
+            }
+        }
+
+        double best = std::numeric_limits<double>::infinity();
+        argmin = n;
+        for (size_t v = 0; v < n; ++v) {
+            if (walk[n][v] == INF)
+                continue;
+            double worst = -std::numeric_limits<double>::infinity();
+            for (size_t k = 0; k < n; ++k) {
+                if (walk[k][v] != INF)
+                    worst = std::max(worst, static_cast<double>(walk[n][v] - walk[k][v]) / static_cast<double>(n - k));
+            }
+            if (worst < best) {
+                best = worst;
+                argmin = v;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * The lightest walk of n edges into the vertex that attains Karp's minimum repeats a vertex, and every cycle
+     * on it has the minimum mean (Chaturvedi and McConnell), so the first repeat met walking back closes one.
+     */
+    std::vector<size_t> MinimumMeanCycle::karpCycle(const Graph &g) {
+        std::vector<std::vector<long long>> walk;
+        std::vector<std::vector<size_t>> from;
+        size_t n = g.V(), v;
+        karpTable(g, walk, from, v);
+        if (v == n)
+            return {};
+
+        std::vector<size_t> seenAt(n, n), back;
+        for (size_t k = n; seenAt[v] == n; v = from[k--][v]) {
+            seenAt[v] = back.size();
+            back.push_back(v);
+        }
+        // the walk was read against the edges
+        std::vector<size_t> cycle(back.begin() + static_cast<std::ptrdiff_t>(seenAt[v]), back.end());
+        std::reverse(cycle.begin(), cycle.end());
+        std::rotate(cycle.begin(), std::min_element(cycle.begin(), cycle.end()), cycle.end());
+        return cycle;
+    }
+
+    double MinimumMeanCycle::mean(const Graph &g, const std::vector<size_t> &cycle) {
+        long long weight = 0;
+        for (size_t i = 0; i < cycle.size(); ++i)
+            weight += g.getEdgeWeight(cycle[i], cycle[(i + 1) % cycle.size()]);
+        return static_cast<double>(weight) / static_cast<double>(cycle.size());
+    }
+
+    // peels off the vertices without an out-edge into the remaining graph, repeatedly
+    std::vector<bool> MinimumMeanCycle::cyclicPart(const Graph &g) {
+        size_t n = g.V();
+        std::vector<std::vector<size_t>> incoming(n);
+        std::vector<size_t> outDegree(n, 0), sinks;
+        for (size_t u = 0; u < n; ++u) {
+            for (size_t v : g.neighbors(u))
+                incoming[v].push_back(u);
+            outDegree[u] = g.neighbors(u).size();
+            if (outDegree[u] == 0)
+                sinks.push_back(u);
+        }
+
+        std::vector<bool> alive(n, true);
+        while (!sinks.empty()) {
+            size_t v = sinks.back();
+            sinks.pop_back();
+            alive[v] = false;
+            for (size_t u : incoming[v]) {
+                if (--outDegree[u] == 0)
+                    sinks.push_back(u);
+            }
+        }
+        return alive;
+    }
+}
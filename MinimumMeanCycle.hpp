@@ -0,0 +1,45 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef MINIMUM_MEAN_CYCLE_HPP
+#define MINIMUM_MEAN_CYCLE_HPP
+
+#include "Graph.hpp"
+#include <string>
+#include <vector>
+
+namespace ariel {
+    /**
+     * The cycle of smallest mean edge weight (total weight over number of edges).
+     * a negative minimum mean means a negative cycle, and in a graph of negated log exchange rates the minimum mean
+     * cycle is the most profitable arbitrage per trade.
+     * undirected graphs are taken as symmetric directed graphs, so every edge is a cycle of two edges.
+     */
+    class MinimumMeanCycle {
+    public:
+        // the cycle and its weight, or a message if the graph has no cycle
+        static std::string Execute(const Graph &g);
+
+        // Howard's policy iteration, the vertices of a minimum mean cycle in edge order, empty if there is none.
+        // past maxIterations policies the cycle is taken from Karp's algorithm instead
+        static std::vector<size_t> howard(const Graph &g, size_t maxIterations = 1000);
+
+        // Karp's algorithm, the minimum mean itself, +infinity if there is no cycle. O(V*E) time and O(V^2) memory
+        static double karp(const Graph &g);
+
+        // the mean edge weight of the cycle
+        static double mean(const Graph &g, const std::vector<size_t> &cycle);
+
+    private:
+        // vertices that lie on a cycle or lead to one, the others can never be part of a policy
+        static std::vector<bool> cyclicPart(const Graph &g);
+
+        // Karp's table of lightest walks with the vertex each one came from, returns the minimum mean and the
+        // vertex it was found at, n if there is no cycle
+        static double karpTable(const Graph &g, std::vector<std::vector<long long>> &walk,
+                                std::vector<std::vector<size_t>> &from, size_t &argmin);
+        // a minimum mean cycle read from Karp's table, empty if there is none
+        static std::vector<size_t> karpCycle(const Graph &g);
+    };
+}
+
+#endif // MINIMUM_MEAN_CYCLE_HPP
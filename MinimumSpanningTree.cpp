@@ -0,0 +1,234 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "MinimumSpanningTree.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace ariel {
+
+    namespace {
+        // union-find with path halving and union by size
+        class DisjointSets {
+        public:
+            explicit DisjointSets(size_t n) : parent(n), size(n, 1) {
+                std::iota(parent.begin(), parent.end(), size_t(0));
+            }
+
+            size_t find(size_t v) {
+                while (parent[v] != v) {
+                    parent[v] = parent[parent[v]];
+                    v = parent[v];
+                }
+                return v;
+            }
+
+            // false if a and b were in the same set already
+            bool unite(size_t a, size_t b) {
+                a = find(a);
+                b = find(b);
+                if (a == b)
+                    return false;
+                if (size[a] < size[b])
+                    std::swap(a, b);
+                parent[b] = a;
+                size[a] += size[b];
+                return true;
+            }
+
+        private:
+            std::vector<size_t> parent;
+            std::vector<size_t> size;
+        };
+    }
+
+    /**
+     * Computes a minimum spanning forest.
+     * like ShortestPath::Execute the engine follows the graph properties: Prim's O(V^2) matrix scan when at least
+     * a quarter of the matrix is edges, Boruvka on all cores for large sparse graphs, Kruskal otherwise.
+     * @param g The undirected graph.
+     * @param engine The algorithm to use, AUTO chooses by density and size.
+     * @param threads Number of worker threads for Boruvka.
+     * @return The forest edges, with u < v, sorted by their endpoints.
+     * @throws std::invalid_argument if the graph is directed.
+     */
+    std::vector<MinimumSpanningTree::Edge> MinimumSpanningTree::Execute(const Graph &g, MstEngine engine,
+                                                                        size_t threads) {
+        if (g.getGraphType() == GraphType::DIRECTED)
+            throw std::invalid_argument("Minimum spanning tree requires an undirected graph");
+
+        if (engine == MstEngine::AUTO) {
+            if (g.E() >= g.V() * g.V() / 4)
+                engine = MstEngine::PRIM;
+            else if (g.V() > PARALLEL_THRESHOLD)
+                engine = MstEngine::BORUVKA;
+            else
+                engine = MstEngine::KRUSKAL;
+        }
+
+        std::vector<Edge> forest;
+        switch (engine) {
+            case MstEngine::PRIM:
+                forest = prim(g);
+                break;
+            case MstEngine::BORUVKA:
+                forest = boruvka(g, threads);
+                break;
+            default:
+                forest = kruskal(g);
+        }
+        sortByEndpoints(forest);
+        return forest;
+    }
+
+    long long MinimumSpanningTree::totalWeight(const std::vector<Edge> &forest) {
+        long long weight = 0;
+        for (const Edge &edge : forest)
+            weight += edge.weight;
+        return weight;
+    }
+
+    std::string MinimumSpanningTree::toString(const std::vector<Edge> &forest) {
+        std::string result = "Minimum spanning forest of weight " + std::to_string(totalWeight(forest)) + ":";
+        for (const Edge &edge : forest)
+            result += " (" + std::to_string(edge.u) + "," + std::to_string(edge.v) + ")";
+        return result;
+    }
+
+    std::vector<MinimumSpanningTree::Edge> MinimumSpanningTree::prim(const Graph &g) {
+        size_t n = g.V();
+        std::vector<bool> inTree(n, false);
+        // the lightest known edge from the tree to every vertex, weight INT_MAX marks none
+        std::vector<Edge> best(n, Edge{0, 0, std::numeric_limits<int>::max()});
+        std::vector<bool> hasBest(n, false);
+        std::vector<Edge> forest;
+
+        for (size_t start = 0; start < n; ++start) {
+            if (inTree[start])
+                continue;
+            // a new tree of the forest
+            size_t u = start;
+            while (true) {
+                inTree[u] = true;
+                for (size_t v = 0; v < n; ++v) {
+                    int weight = g.getEdgeWeight(u, v);
+                    if (weight == 0 || inTree[v])
+                        continue;
+                    Edge edge = makeEdge(u, v, weight);
+                    if (!hasBest[v] || lighter(edge, best[v])) {
+                        best[v] = edge;
+                        hasBest[v] = true;
+                    }
+                }
+                // the closest vertex outside the tree
+                size_t next = n;
+                for (size_t v = 0; v < n; ++v) {
+                    if (!inTree[v] && hasBest[v] && (next == n || lighter(best[v], best[next])))
+                        next = v;
+                }
+                if (next == n)
+                    break;
+                forest.push_back(best[next]);
+                u = next;
+            }
+        }
+        return forest;
+    }
+
+    std::vector<MinimumSpanningTree::Edge> MinimumSpanningTree::kruskal(const Graph &g) {
+        std::vector<Edge> edges;
+        for (size_t u = 0; u < g.V(); ++u) {
+            for (size_t v : g.neighbors(u)) {
+                if (u < v)
+                    edges.push_back(Edge{u, v, g.getEdgeWeight(u, v)});
+            }
+        }
+        std::sort(edges.begin(), edges.end(), lighter);
+
+        DisjointSets sets(g.V());
+        std::vector<Edge> forest;
+        for (const Edge &edge : edges) {
+            if (sets.unite(edge.u, edge.v))
+                forest.push_back(edge);
+        }
+        return forest;
+    }
+
+    /**
+     * Boruvka's algorithm: in every round each component adds the cheapest edge leaving it, which at least halves
+     * the number of components. the edge scan of a round is split between the threads by vertex, then the
+     * cheapest edge of each component is picked from its vertices' candidates.
+     */
+    std::vector<MinimumSpanningTree::Edge> MinimumSpanningTree::boruvka(const Graph &g, size_t threads) {
+        size_t n = g.V();
+        DisjointSets sets(n);
+        std::vector<size_t> component(n);
+        std::vector<Edge> cheapest(n);
+        // one byte per vertex, the threads write neighbouring entries and std::vector<bool> packs them into words
+        std::vector<char> found(n);
+        std::vector<Edge> forest;
+
+        bool merged = true;
+        while (merged) {
+            for (size_t v = 0; v < n; ++v)
+                component[v] = sets.find(v);
+
+            // the cheapest edge from every vertex to another component
+            Parallel::forEach(0, n, threads, [&](size_t, size_t u) {
+                bool any = false;
+                Edge best{0, 0, 0};
+                for (size_t v : g.neighbors(u)) {
+                    if (component[v] == component[u])
+                        continue;
+                    Edge edge = makeEdge(u, v, g.getEdgeWeight(u, v));
+                    if (!any || lighter(edge, best)) {
+                        best = edge;
+                        any = true;
+                    }
+                }
+                cheapest[u] = best;
+                found[u] = any ? 1 : 0;
+            });
+
+            // the cheapest edge of every component
+            std::vector<size_t> choice(n, n);
+            for (size_t u = 0; u < n; ++u) {
+                size_t c = component[u];
+                if (found[u] && (choice[c] == n || lighter(cheapest[u], cheapest[choice[c]])))
+                    choice[c] = u;
+            }
+
+            merged = false;
+            for (size_t c = 0; c < n; ++c) {
+                if (choice[c] == n)
+                    continue;
+                const Edge &edge = cheapest[choice[c]];
+                // two components may pick the same edge, the union-find keeps it once
+                if (sets.unite(edge.u, edge.v)) {
+                    forest.push_back(edge);
+                    merged = true;
+                }
+            }
+        }
+        return forest;
+    }
+
+    bool MinimumSpanningTree::lighter(const Edge &a, const Edge &b) {
+        if (a.weight != b.weight)
+            return a.weight < b.weight;
+        if (a.u != b.u)
+            return a.u < b.u;
+        return a.v < b.v;
+    }
+
+    MinimumSpanningTree::Edge MinimumSpanningTree::makeEdge(size_t a, size_t b, int weight) {
+        return a < b ? Edge{a, b, weight} : Edge{b, a, weight};
+    }
+
+    void MinimumSpanningTree::sortByEndpoints(std::vector<Edge> &forest) {
+        std::sort(forest.begin(), forest.end(), [](const Edge &a, const Edge &b) {
+            return a.u != b.u ? a.u < b.u : a.v < b.v;
+        });
+    }
+}
@@ -0,0 +1,49 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef MINIMUM_SPANNING_TREE_HPP
+#define MINIMUM_SPANNING_TREE_HPP
+
+#include "Graph.hpp"
+#include "Parallel.hpp"
+#include <string>
+#include <vector>
+
+namespace ariel {
+    // algorithm for the minimum spanning forest, AUTO picks one from the density and size of the graph
+    enum class MstEngine { AUTO, PRIM, KRUSKAL, BORUVKA };
+
+    /**
+     * Minimum spanning forest of an undirected graph, one tree per connected component.
+     * ties between equal weights are broken by the endpoints of the edges, so all engines return the same forest.
+     */
+    class MinimumSpanningTree {
+    public:
+        struct Edge {
+            size_t u; // the smaller endpoint
+            size_t v;
+            int weight;
+        };
+
+        // the forest edges sorted by their endpoints
+        static std::vector<Edge> Execute(const Graph &g, MstEngine engine = MstEngine::AUTO,
+                                         size_t threads = Parallel::numThreads());
+        static long long totalWeight(const std::vector<Edge> &forest);
+        // the forest as a string, its weight followed by the edges
+        static std::string toString(const std::vector<Edge> &forest);
+
+    private:
+        // Prim's algorithm over the adjacency matrix, O(V^2) which is optimal for dense graphs
+        static std::vector<Edge> prim(const Graph &g);
+        // Kruskal's algorithm with union-find, O(E log E) for sparse graphs
+        static std::vector<Edge> kruskal(const Graph &g);
+        // Boruvka's algorithm, the cheapest edge of every vertex is found in parallel in each round
+        static std::vector<Edge> boruvka(const Graph &g, size_t threads);
+
+        // the total order used for ties: weight, then smaller endpoint, then larger endpoint
+        static bool lighter(const Edge &a, const Edge &b);
+        static Edge makeEdge(size_t a, size_t b, int weight);
+        static void sortByEndpoints(std::vector<Edge> &forest);
+    };
+}
+
+#endif // MINIMUM_SPANNING_TREE_HPP
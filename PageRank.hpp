@@ -0,0 +1,109 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef PAGE_RANK_HPP
+#define PAGE_RANK_HPP
+
+#include "Graph.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace ariel {
+    /**
+     * PageRank over the edge weights as transition strengths, an unweighted graph gives the classic PageRank.
+     * Real is float or double, the precision of the ranks and of the iteration.
+     */
+    class PageRank {
+    public:
+        // ranks summing to 1, the random surfer jumps to a uniformly random vertex
+        template <typename Real = double>
+        static std::vector<Real> Execute(const Graph &g, Real damping = Real(0.85), Real tolerance = Real(1e-6),
+                                         size_t maxIterations = 100);
+
+        // ranks summing to 1, the random surfer jumps back to one of the seeds
+        template <typename Real = double>
+        static std::vector<Real> personalized(const Graph &g, const std::vector<size_t> &seeds,
+                                              Real damping = Real(0.85), Real tolerance = Real(1e-6),
+                                              size_t maxIterations = 100);
+
+    private:
+        template <typename Real>
+        static std::vector<Real> iterate(const Graph &g, const std::vector<Real> &teleport, Real damping,
+                                         Real tolerance, size_t maxIterations);
+    };
+
+    template <typename Real>
+    std::vector<Real> PageRank::Execute(const Graph &g, Real damping, Real tolerance, size_t maxIterations) {
+        std::vector<Real> teleport(g.V(), g.V() == 0 ? Real(0) : Real(1) / static_cast<Real>(g.V()));
+        return iterate(g, teleport, damping, tolerance, maxIterations);
+    }
+
+    template <typename Real>
+    std::vector<Real> PageRank::personalized(const Graph &g, const std::vector<size_t> &seeds, Real damping,
+                                             Real tolerance, size_t maxIterations) {
+        if (seeds.empty())
+            throw std::invalid_argument("Personalized PageRank requires at least one seed");
+        std::vector<Real> teleport(g.V(), Real(0));
+        for (size_t seed : seeds) {
+            if (seed >= g.V())
+                throw std::invalid_argument("Invalid seed vertex");
+            teleport[seed] += Real(1) / static_cast<Real>(seeds.size());
+        }
+        return iterate(g, teleport, damping, tolerance, maxIterations);
+    }
+
+    /**
+     * Power iteration in pull form: the new rank of v is gathered from its in-neighbours, which is the product of
+     * the transposed matrix with the ranks scaled by the out-weights, computed by Graph::transposeMultiply over the
+     * in-neighbour lists, so no transposed copy of the matrix is made, every vertex writes only its own entry and
+     * the threads need no atomics. the rank of vertices without out-edges is spread
+     * like the teleport. stops once the ranks move less than tolerance in L1 norm.
+     * @param g The graph, must not have negative edges.
+     * @param teleport Where the surfer jumps to, sums to 1.
+     * @param damping Probability of following an edge rather than jumping.
+     * @param tolerance L1 change of the ranks below which the iteration stops.
+     * @param maxIterations Limit on the number of iterations.
+     * @return The rank of every vertex.
+     * @throws std::invalid_argument if the graph has negative edges or damping is not in [0, 1].
+     */
+    template <typename Real>
+    std::vector<Real> PageRank::iterate(const Graph &g, const std::vector<Real> &teleport, Real damping,
+                                        Real tolerance, size_t maxIterations) {
+        if (g.getEdgeNegativity() == EdgeNegativity::NEGATIVE)
+            throw std::invalid_argument("PageRank requires a graph without negative edges");
+        if (!(damping >= 0 && damping <= 1))
+            throw std::invalid_argument("Damping must be between 0 and 1");
+
+        size_t n = g.V();
+        std::vector<Real> outWeight(n, Real(0));
+        for (size_t u = 0; u < n; ++u)
+            g.forEachNeighbor(u, [&](size_t, int weight) { outWeight[u] += static_cast<Real>(weight); });
+
+        std::vector<Real> rank = teleport, scaled(n);
+        for (size_t iteration = 0; iteration < maxIterations; ++iteration) {
+            Real dangling = 0;
+            for (size_t u = 0; u < n; ++u) {
+                if (outWeight[u] > 0) {
+                    scaled[u] = rank[u] / outWeight[u];
+                } else {
+                    scaled[u] = 0;
+                    dangling += rank[u];
+                }
+            }
+
+            std::vector<Real> next = g.transposeMultiply(scaled);
+            Real jump = damping * dangling + (Real(1) - damping);
+            Real change = 0;
+            for (size_t v = 0; v < n; ++v) {
+                next[v] = damping * next[v] + jump * teleport[v];
+                change += std::abs(next[v] - rank[v]);
+            }
+            rank.swap(next);
+            if (change < tolerance)
+                break;
+        }
+        return rank;
+    }
+}
+
+#endif // PAGE_RANK_HPP
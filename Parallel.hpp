@@ -0,0 +1,172 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <cstddef>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <exception>
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+
+// graphs with more vertices than this are handed to the multi-threaded engines
+#define PARALLEL_THRESHOLD 2048
+
+namespace ariel {
+    /**
+     * Worker threads that stay alive between parallel calls, so a loop that runs once per BFS level or per
+     * bucket does not pay for creating and joining threads every time.
+     * the pool is created on first use and grows to the largest number of helpers a call asked for.
+     * one call is served at a time, a call made while the pool is busy or from inside a worker gets false
+     * and is expected to do the work in its own thread.
+     */
+    class ThreadPool {
+    public:
+        static ThreadPool &instance() {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (std::thread &worker : workers)
+                worker.join();
+        }
+
+        // runs task(1) .. task(helpers) on the workers and task(0) in the calling thread, returns once all finished.
+        // task must not throw
+        bool run(size_t helpers, const std::function<void(size_t)> &task) {
+            if (insideWorker())
+                return false;
+            std::unique_lock<std::mutex> call(callMutex, std::try_to_lock);
+            if (!call.owns_lock())
+                return false;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                while (workers.size() < helpers)
+                    workers.emplace_back(&ThreadPool::loop, this, workers.size(), generation);
+                job = &task;
+                active = helpers;
+                pending = helpers;
+                ++generation;
+            }
+            wake.notify_all();
+            task(0);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [this]() { return pending == 0; });
+            job = nullptr;
+            return true;
+        }
+
+    private:
+        ThreadPool() = default;
+
+        static bool &insideWorker() {
+            thread_local bool inside = false;
+            return inside;
+        }
+
+        // worker `index` runs task(index + 1) of every call that asked for more than index helpers
+        void loop(size_t index, size_t seen) {
+            insideWorker() = true;
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                wake.wait(lock, [&]() { return stopping || generation != seen; });
+                if (stopping)
+                    return;
+                seen = generation;
+                if (index >= active)
+                    continue;
+                const std::function<void(size_t)> &task = *job;
+                lock.unlock();
+                task(index + 1);
+                lock.lock();
+                if (--pending == 0)
+                    done.notify_one();
+            }
+        }
+
+        std::vector<std::thread> workers;
+        std::mutex callMutex, mutex;
+        std::condition_variable wake, done;
+        const std::function<void(size_t)> *job = nullptr;
+        size_t active = 0, pending = 0, generation = 0;
+        bool stopping = false;
+    };
+
+    class Parallel {
+    public:
+        // number of hardware threads available, at least 1
+        static size_t numThreads() {
+            unsigned int hw = std::thread::hardware_concurrency();
+            return hw == 0 ? 1 : static_cast<size_t>(hw);
+        }
+
+        /**
+         * Calls fn(thread, i) for every i in [begin, end) using up to `threads` workers.
+         * Indices are handed out in blocks of `grain` through a shared counter, so uneven
+         * work per index is balanced between the workers.
+         * `thread` is the worker id in [0, threads) and can be used to index per-thread buffers.
+         * The workers come from ThreadPool, when the pool is busy (another caller, or a nested call from a
+         * worker) the calling thread goes through all the indices itself.
+         * The first exception thrown by a worker is rethrown in the calling thread.
+         */
+        template <typename Func>
+        static void forEach(size_t begin, size_t end, size_t threads, Func fn, size_t grain = 64) {
+            if (begin >= end)
+                return;
+            if (grain == 0)
+                grain = 1;
+            size_t blocks = (end - begin + grain - 1) / grain;
+            threads = std::max<size_t>(1, std::min(threads, blocks));
+
+            // run inline when there is nothing to split
+            if (threads == 1) {
+                for (size_t i = begin; i < end; ++i)
+                    fn(size_t(0), i);
+                return;
+            }
+
+            std::atomic<size_t> next(begin);
+            std::exception_ptr error;
+            std::atomic<bool> failed(false);
+
+            auto worker = [&](size_t thread) {
+                try {
+                    while (!failed.load()) {
+                        size_t from = next.fetch_add(grain);
+                        if (from >= end)
+                            break;
+                        size_t to = std::min(end, from + grain);
+                        for (size_t i = from; i < to; ++i)
+                            fn(thread, i);
+                    }
+                } catch (...) {
+                    bool expected = false;
+                    if (failed.compare_exchange_strong(expected, true))
+                        error = std::current_exception();
+                }
+            };
+
+            if (!ThreadPool::instance().run(threads - 1, std::function<void(size_t)>(worker)))
+                worker(0);
+
+            if (error)
+                std::rethrow_exception(error);
+        }
+    };
+}
+
+#endif // PARALLEL_HPP
@@ -0,0 +1,223 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef PRIORITY_QUEUES_HPP
+#define PRIORITY_QUEUES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * Priority queues of vertices keyed by their tentative distance, used as the Queue policy of Dijkstra.
+ * all of them share the same interface:
+ *   Queue(size_t numVertices, int maxWeight)
+ *   void reset(size_t numVertices, int maxWeight)   empty the queue for a new run, keeping its storage
+ *   bool empty() const
+ *   void push(size_t v, int key)     insert v, or lower its key if it is already queued
+ *   std::pair<int, size_t> pop()     remove and return (key, vertex) with the minimal key
+ * lazy queues may return a vertex more than once, the caller skips entries whose key is outdated.
+ */
+namespace ariel {
+
+    /**
+     * Indexed d-ary min heap with a real decrease-key, every vertex is stored at most once.
+     */
+    template <size_t D = 4>
+    class IndexedDaryHeap {
+    public:
+        IndexedDaryHeap(size_t numVertices, int maxWeight) {
+            reset(numVertices, maxWeight);
+        }
+
+        void reset(size_t numVertices, int /*maxWeight*/) {
+            // only the vertices still queued have a position to clear
+            for (size_t v : heap)
+                position[v] = NOT_IN_HEAP;
+            heap.clear();
+            if (position.size() < numVertices) {
+                position.resize(numVertices, NOT_IN_HEAP);
+                key.resize(numVertices, 0);
+            }
+        }
+
+        bool empty() const { return heap.empty(); }
+
+        void push(size_t v, int newKey) {
+            if (position[v] == NOT_IN_HEAP) {
+                position[v] = heap.size();
+                heap.push_back(v);
+            } else if (newKey >= key[v]) {
+                return;
+            }
+            key[v] = newKey;
+            siftUp(position[v]);
+        }
+
+        std::pair<int, size_t> pop() {
+            size_t top = heap[0];
+            position[top] = NOT_IN_HEAP;
+            size_t last = heap.back();
+            heap.pop_back();
+            if (!heap.empty()) {
+                heap[0] = last;
+                position[last] = 0;
+                siftDown(0);
+            }
+            return std::make_pair(key[top], top);
+        }
+
+    private:
+        static const size_t NOT_IN_HEAP = std::numeric_limits<size_t>::max();
+
+        std::vector<size_t> heap;      // vertices in heap order
+        std::vector<size_t> position;  // index of each vertex in heap
+        std::vector<int> key;
+
+        void place(size_t i, size_t v) {
+            heap[i] = v;
+            position[v] = i;
+        }
+
+        void siftUp(size_t i) {
+            size_t v = heap[i];
+            while (i > 0) {
+                size_t parent = (i - 1) / D;
+                if (key[heap[parent]] <= key[v])
+                    break;
+                place(i, heap[parent]);
+                i = parent;
+            }
+            place(i, v);
+        }
+
+        void siftDown(size_t i) {
+            size_t v = heap[i];
+            while (true) {
+                size_t first = i * D + 1;
+                if (first >= heap.size())
+                    break;
+                size_t best = first;
+                size_t end = first + D < heap.size() ? first + D : heap.size();
+                for (size_t c = first + 1; c < end; ++c) {
+                    if (key[heap[c]] < key[heap[best]])
+                        best = c;
+                }
+                if (key[heap[best]] >= key[v])
+                    break;
+                place(i, heap[best]);
+                i = best;
+            }
+            place(i, v);
+        }
+    };
+
+    template <size_t D>
+    const size_t IndexedDaryHeap<D>::NOT_IN_HEAP;
+
+    /**
+     * Radix heap for monotone non-negative integer keys: a pushed key is never smaller than the last popped one,
+     * which always holds in Dijkstra. buckets are indexed by the highest bit in which a key differs from the last
+     * popped key, so every entry moves down at most 32 times. decrease-key is lazy (the vertex is pushed again).
+     */
+    class RadixHeap {
+    public:
+        RadixHeap(size_t /*numVertices*/, int /*maxWeight*/) : buckets(BUCKETS), last(0), count(0) {}
+
+        void reset(size_t /*numVertices*/, int /*maxWeight*/) {
+            for (std::vector<Entry> &bucket : buckets)
+                bucket.clear();
+            last = 0;
+            count = 0;
+        }
+
+        bool empty() const { return count == 0; }
+
+        void push(size_t v, int key) {
+            if (key < 0 || uint32_t(key) < last)
+                throw std::invalid_argument("Radix heap keys must be non-negative and monotone");
+            buckets[bucketOf(uint32_t(key))].push_back(std::make_pair(uint32_t(key), v));
+            count++;
+        }
+
+        std::pair<int, size_t> pop() {
+            if (buckets[0].empty()) {
+                size_t i = 1;
+                while (buckets[i].empty())
+                    i++;
+                // the smallest key of the first non-empty bucket becomes the new reference
+                uint32_t smallest = buckets[i][0].first;
+                for (const Entry &entry : buckets[i]) {
+                    if (entry.first < smallest)
+                        smallest = entry.first;
+                }
+                last = smallest;
+                std::vector<Entry> moved;
+                moved.swap(buckets[i]);
+                for (const Entry &entry : moved)
+                    buckets[bucketOf(entry.first)].push_back(entry);
+            }
+            Entry entry = buckets[0].back();
+            buckets[0].pop_back();
+            count--;
+            return std::make_pair(int(entry.first), entry.second);
+        }
+
+    private:
+        typedef std::pair<uint32_t, size_t> Entry;
+        static const size_t BUCKETS = 33;
+
+        std::vector<std::vector<Entry>> buckets;
+        uint32_t last;
+        size_t count;
+
+        size_t bucketOf(uint32_t key) const {
+            uint32_t diff = key ^ last;
+            return diff == 0 ? 0 : size_t(32 - __builtin_clz(diff));
+        }
+    };
+
+    /**
+     * Dial's bucket queue for small non-negative integer weights: with weights at most C all queued keys lie in
+     * [current, current + C], so C + 1 circular buckets are enough. decrease-key is lazy (the vertex is pushed again).
+     */
+    class DialQueue {
+    public:
+        DialQueue(size_t numVertices, int maxWeight) : current(0), count(0) {
+            reset(numVertices, maxWeight);
+        }
+
+        void reset(size_t /*numVertices*/, int maxWeight) {
+            for (std::vector<std::pair<int, size_t>> &bucket : buckets)
+                bucket.clear();
+            buckets.resize(size_t(maxWeight < 0 ? 0 : maxWeight) + 1);
+            current = 0;
+            count = 0;
+        }
+
+        bool empty() const { return count == 0; }
+
+        void push(size_t v, int key) {
+            buckets[size_t(key) % buckets.size()].push_back(std::make_pair(key, v));
+            count++;
+        }
+
+        std::pair<int, size_t> pop() {
+            while (buckets[current].empty())
+                current = (current + 1) % buckets.size();
+            std::pair<int, size_t> entry = buckets[current].back();
+            buckets[current].pop_back();
+            count--;
+            return entry;
+        }
+
+    private:
+        std::vector<std::vector<std::pair<int, size_t>>> buckets;
+        size_t current;
+        size_t count;
+    };
+}
+
+#endif // PRIORITY_QUEUES_HPP
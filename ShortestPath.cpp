@@ -11,9 +11,12 @@ namespace ariel {
      * @param g The graph in which to find the shortest path.
      * @param source The source vertex.
      * @param dest The destination vertex.
+     * @param engine The algorithm for weighted graphs without negative edges, AUTO uses delta-stepping on large graphs.
+     * @param workspace Scratch buffers for Dijkstra and Bellman-Ford, reused between calls.
      * @return A string describing the shortest path, or an error message if no path exists or input is invalid.
      */
-    std::string ShortestPath::Execute(const ariel::Graph &g, size_t source, size_t dest) {
+    std::string ShortestPath::Execute(const ariel::Graph &g, size_t source, size_t dest, WeightedEngine engine,
+                                      Workspace &workspace) {
         std::vector<size_t> shortestPath;
         if (!isValidInput(g, source, dest))
              throw std::invalid_argument("Invalid input for finding shortest path");
@@ -21,17 +24,21 @@ namespace ariel {
         switch (g.getEdgeNegativity()) {
             case EdgeNegativity::NEGATIVE:
                 // Use Bellman-Ford algorithm for graphs with negative weights
-                return bellmanFordSetUps(g,source,dest);
+                return bellmanFordSetUps(g,source,dest,workspace);
             default:
                 // Check for unweighted, weighted, or unknown graphs
                 switch (g.getEdgeType()) {
                     case EdgeType::WEIGHTED:
-                        // Use Dijkstra's algorithm for weighted graphs with non-negative weights
-                        shortestPath = dijkstra(g, source, dest);
+                        // Use delta-stepping on large graphs (or when asked to), Dijkstra's algorithm otherwise
+                        if (engine == WeightedEngine::DELTA_STEPPING ||
+                            (engine == WeightedEngine::AUTO && g.V() > PARALLEL_THRESHOLD))
+                            shortestPath = deltaStepping(g, source, dest);
+                        else
+                            shortestPath = dijkstra(g, source, dest, workspace);
                         break;
                     case EdgeType::UNWEIGHTED:
                         // Use BFS for unweighted graphs
-                        shortestPath = bfs(g, source, dest);
+                        shortestPath = bfs(g, source, dest, workspace);
                         break;
                     default:
                         // Handle unknown edge types
@@ -46,54 +53,128 @@ namespace ariel {
     }
 
 
-    // finding the shortest path from source to dest using dijkstra's algorithm
-    std::vector<size_t> ShortestPath::dijkstra(const Graph &g, size_t source, size_t dest) {
-        // init the predecessors array to infinity to indicate no pred
-        std::vector<size_t> predecessors(g.V(), std::numeric_limits<size_t>::max());
-        // init the distance array to infinity for each vertex
-        std::vector<int> dist(g.V(), std::numeric_limits<int>::max());
-        dist[source] = 0;
-        // create a priority que to store the distance from source of each vertex
-        std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>,
-                    std::greater<std::pair<int, size_t>>> pq;
-        // insert source vertex with distance 0 to the pq
-        pq.emplace(0, source);
+    /**
+     * Answers a batch of shortest path queries concurrently.
+     * queries are grouped by source so a single shortest path tree per distinct source serves all its destinations,
+     * and the sources are spread over the persistent workers of ThreadPool, whose cached workspaces carry over from
+     * one batch to the next. every answer is identical to Execute(g, source, dest).
+     * graphs with negative edges fall back to running Execute for each query in parallel.
+     * @param g The graph in which to find the shortest paths.
+     * @param queries The (source, dest) pairs.
+     * @param threads Number of worker threads.
+     * @return The answer of each query, in the order of the queries.
+     * @throws std::invalid_argument if any query is invalid.
+     */
+    std::vector<std::string> ShortestPath::ExecuteBatch(const Graph &g, const std::vector<std::pair<size_t, size_t>> &queries,
+                                                        size_t threads) {
+        for (const std::pair<size_t, size_t> &query : queries) {
+            if (!isValidInput(g, query.first, query.second))
+                throw std::invalid_argument("Invalid input for finding shortest path");
+        }
+        std::vector<std::string> answers(queries.size());
 
-        while (!pq.empty()) {
-            //extract the vertex with the min distance
-            int dist_u = pq.top().first;
-            size_t u = pq.top().second;
-            pq.pop();
+        if (g.getEdgeNegativity() == EdgeNegativity::NEGATIVE) {
+            Parallel::forEach(0, queries.size(), threads, [&](size_t, size_t i) {
+                answers[i] = Execute(g, queries[i].first, queries[i].second);
+            }, 1);
+            return answers;
+        }
 
-            // relax all the adj of u if necessary
-            for (size_t v = 0; v < g.V(); v++) {
+        // group the query indices by their source
+        std::map<size_t, std::vector<size_t>> bySource;
+        for (size_t i = 0; i < queries.size(); ++i)
+            bySource[queries[i].first].push_back(i);
+        std::vector<std::pair<size_t, std::vector<size_t>>> groups(bySource.begin(), bySource.end());
+
+        // every source runs single threaded on the workspace of its worker thread, whose distance array is
+        // reset in O(1) from one source to the next and, since the pool keeps its threads, from one batch to the
+        // next, the parallelism is across sources
+        Parallel::forEach(0, groups.size(), threads, [&](size_t, size_t i) {
+            size_t source = groups[i].first;
+            Workspace &workspace = Workspace::local();
+            distances(g, source, workspace);
+            answerQueries(g, source, workspace.dist, groups[i].second, queries, answers);
+        }, 1);
+        return answers;
+    }
 
-                int weight_uv = g.getEdgeWeight(u, v);
+    // fills the answers of the queries from source given the distances from source
+    template <typename DistArray>
+    void ShortestPath::answerQueries(const Graph &g, size_t source, DistArray &dist, const std::vector<size_t> &indices,
+                                     const std::vector<std::pair<size_t, size_t>> &queries,
+                                     std::vector<std::string> &answers) {
+        for (size_t index : indices) {
+            size_t dest = queries[index].second;
+            if (dist[dest] == std::numeric_limits<int>::max() || source == dest)
+                answers[index] = "There is no path from " + std::to_string(source) + " to " + std::to_string(dest);
+            else
+                answers[index] = constructPath(buildShortestPath(g, dist, source, dest), source, dest);
+        }
+    }
 
-                if (weight_uv != 0) {
-                    if (dist[v] > dist_u + weight_uv) {
-                        dist[v] = dist_u + weight_uv;
-                        predecessors[v] = u;
-                        pq.emplace(dist[v], v);
-                    }
-                }
-            }
+    /**
+     * Computes the unweighted (number of edges) distances from a batch of sources in one shared traversal.
+     * replaces a loop of bfs queries from different sources on the same graph.
+     * @param g The graph, edge weights are ignored.
+     * @param sources The source vertices.
+     * @return rows[i][v] is the number of edges on a shortest path from sources[i] to v, INT_MAX if there is no path.
+     * @throws std::invalid_argument if the graph is empty or a source is out of range.
+     */
+    std::vector<std::vector<int>> ShortestPath::bfsDistances(const Graph &g, const std::vector<size_t> &sources) {
+        for (size_t source : sources) {
+            if (!isValidInput(g, source, source))
+                throw std::invalid_argument("Invalid input for finding shortest path");
         }
-        // check if there is path
-        if (predecessors[dest] == std::numeric_limits<size_t>::max())
+        return BfsEngine::multiSourceDistances(g, sources);
+    }
+
+    // finding the shortest path from source to dest using dijkstra's algorithm
+    std::vector<size_t> ShortestPath::dijkstra(const Graph &g, size_t source, size_t dest, Workspace &workspace) {
+        weightedDistances(g, source, dest, workspace);
+        StampedArray<int> &dist = workspace.dist;
+
+        // check if there is path, a vertex has no path to itself
+        if (dist[dest] == std::numeric_limits<int>::max() || source == dest)
             return {};
 
+        return buildShortestPath(g, dist, source, dest);
+    }
 
-        return buildShortestPath(g,dist,source,dest);
+    // distances from source for graphs without negative edges, left in workspace.dist with the settling order
+    // in workspace.queue
+    void ShortestPath::weightedDistances(const Graph &g, size_t source, size_t dest, Workspace &workspace) {
+        workspace.dist.reset(g.V(), std::numeric_limits<int>::max());
+        // Dial's buckets are cheapest while the weights stay small, the d-ary heap handles any weight
+        NoParents parents;
+        workspace.queue.clear();
+        if (g.getMaxWeight() <= MAX_WEIGHT) {
+            workspace.dial.reset(g.V(), g.getMaxWeight());
+            dijkstraRun(g, source, dest, workspace.dial, workspace.dist, parents, workspace.queue);
+        } else {
+            workspace.heap.reset(g.V(), g.getMaxWeight());
+            dijkstraRun(g, source, dest, workspace.heap, workspace.dist, parents, workspace.queue);
+        }
+    }
 
+    // finding the shortest path from source to dest using the parallel delta-stepping engine
+    std::vector<size_t> ShortestPath::deltaStepping(const Graph &g, size_t source, size_t dest) {
+        std::vector<int> dist = DeltaStepping::distances(g, source);
+
+        // check if there is path, a vertex has no path to itself
+        if (dist[dest] == std::numeric_limits<int>::max() || source == dest)
+            return {};
+
+        return buildShortestPath(g, dist, source, dest);
     }
 
     // finding the shortest path from source to dest using bellman-ford's algorithm
-    std::vector<size_t> ShortestPath::bellmanFord(const Graph &g, size_t source, size_t dest) {
+    std::vector<size_t> ShortestPath::bellmanFord(const Graph &g, size_t source, size_t dest, Workspace &workspace) {
         // Initialize predecessors with a special value (-1) to indicate no predecessor
-        std::vector<size_t > predecessors(g.V(), size_t(-1));
+        StampedArray<size_t> &predecessors = workspace.predecessors;
+        predecessors.reset(g.V(), size_t(-1));
         // Initialize distances with infinity
-        std::vector<int> dist(g.V(), std::numeric_limits<int>::max());
+        StampedArray<int> &dist = workspace.dist;
+        dist.reset(g.V(), std::numeric_limits<int>::max());
         dist[source] = 0;
 
         // Iterating |V| - 1 times
@@ -104,7 +185,7 @@ namespace ariel {
                     // Perform relaxation on the edge u,v
                     int weight_uv = g.getEdgeWeight(u, v);
                     // Relax the edge if it exists and a shorter path is found
-                    if (weight_uv != 0 && dist[v] > weight_uv + dist[u] && dist[u] != std::numeric_limits<int>::max()) {
+                    if (weight_uv != 0 && dist[u] != std::numeric_limits<int>::max() && dist[v] > weight_uv + dist[u]) {
                         // in undirected graphs, use negative edge only once to relax
                         if(g.getGraphType()==GraphType::UNDIRECTED && predecessors[u] == v) {
                             continue;
@@ -135,55 +216,46 @@ namespace ariel {
 
     }
 
-    // finding the shortest path from source to dest using bds
-    std::vector<size_t> ShortestPath::bfs(const Graph &g, size_t source, size_t dest) {
-        // Array of the parent of each node
-        std::vector<size_t> parents(g.V(), std::numeric_limits<size_t>::max());
-        // Array to indicate if a node was visited during the traversal
-        std::vector<bool> visited(g.V(), false);
-        std::queue<size_t> q;
-
-        visited[source] = true;
-        q.push(source);
-
-        while (!q.empty()) {
-            size_t current = q.front();
-            q.pop();
-
-            // Check if the destination vertex is reached
-            if (current == dest) {
-                break; // Stop BFS traversal
-            }
-
-            // Enqueue neighboring vertices
-            for (size_t neighbor = 0; neighbor < g.V(); ++neighbor) {
-                if (!visited[neighbor] && g.getEdgeWeight(current, neighbor) != 0) {
-                    visited[neighbor] = true;
-                    parents[neighbor] = current;
-                    q.push(neighbor);
-                }
-            }
-        }
-        // Check if the destination vertex was reached
-        if (parents[dest] == std::numeric_limits<size_t>::max()) {
-            return {}; // Return an empty vector if no path exists
+    // finding the shortest path from source to dest using the direction-optimizing bfs engine
+    std::vector<size_t> ShortestPath::bfs(const Graph &g, size_t source, size_t dest, Workspace &workspace) {
+        // large graphs split every level of the traversal between all cores
+        if (g.V() > PARALLEL_THRESHOLD) {
+            // number of edges from the source to each vertex, the traversal stops once dest is reached
+            std::vector<int> dist = BfsEngine::distances(g, source, dest, Parallel::numThreads());
+            if (dist[dest] == std::numeric_limits<int>::max() || source == dest)
+                return {};
+            return buildShortestPath(g, dist, source, dest);
         }
 
-        // Reconstruct the shortest path using the parent's array
-        std::vector<size_t> shortestPath;
-        size_t currentVertex = dest;
+        // otherwise on the calling thread with the workspace's stamped storage, reset in O(1) per query
+        BfsEngine::distances(g, source, dest, workspace);
+        StampedArray<int> &dist = workspace.dist;
 
-        // Reconstruct the shortest path by backtracking from the destination to the source
-        while (currentVertex != source) {
-            shortestPath.push_back(currentVertex);
-            currentVertex = parents[currentVertex];
+        // Check if the destination vertex was reached, a vertex has no path to itself
+        if (dist[dest] == std::numeric_limits<int>::max() || source == dest) {
+            return {}; // Return an empty vector if no path exists
         }
-        shortestPath.push_back(source);
 
-        // Reverse the path to get it in the correct order (from source to destination)
-        std::reverse(shortestPath.begin(), shortestPath.end());
+        // every edge costs 1, so the path can be walked back over the distance levels
+        return buildShortestPath(g, dist, source, dest);
+    }
 
-        return shortestPath;
+    /**
+     * Single source distances for the algorithms that run one traversal per source, like betweenness.
+     * @param g The graph, must not have negative edges.
+     * @param source The source vertex.
+     * @param workspace Receives the distances in dist, INT_MAX for unreached vertices.
+     * @throws std::invalid_argument if the source is out of range or the graph has negative edges.
+     */
+    void ShortestPath::distances(const Graph &g, size_t source, Workspace &workspace) {
+        if (!isValidInput(g, source, source))
+            throw std::invalid_argument("Invalid input for finding shortest path");
+        if (g.getEdgeNegativity() == EdgeNegativity::NEGATIVE)
+            throw std::invalid_argument("Single source distances require a graph without negative edges");
+        if (g.getEdgeType() == EdgeType::UNWEIGHTED)
+            BfsEngine::distances(g, source, BfsEngine::NO_VERTEX, workspace);
+        else
+            weightedDistances(g, source, BfsEngine::NO_VERTEX, workspace);
     }
 
     // Checks if the input parameters are valid for finding the shortest path.
@@ -203,10 +275,10 @@ namespace ariel {
         return true; // Valid input
     }
 
-    std::string ShortestPath::bellmanFordSetUps(const Graph &g, size_t source, size_t dest) {
+    std::string ShortestPath::bellmanFordSetUps(const Graph &g, size_t source, size_t dest, Workspace &workspace) {
 
         // find the shortest path from source vx to the dest vx
-        std::vector<size_t> pathFromSourceToDest= bellmanFord(g,source,dest);
+        std::vector<size_t> pathFromSourceToDest= bellmanFord(g,source,dest,workspace);
 
          if( pathFromSourceToDest.empty())
             return "There is no path from " + std::to_string(source) + " to " + std::to_string(dest);
@@ -217,7 +289,7 @@ namespace ariel {
         // handle undirected graphs
         else {
             // find the shortest path from dest vx to the source vx
-            std::vector<size_t> pathFromDestToSource = bellmanFord(g, dest, source);
+            std::vector<size_t> pathFromDestToSource = bellmanFord(g, dest, source, workspace);
 
             // find the cheaper path, and return it
             int weightFromSourceToDest = CalculatePathCost(pathFromSourceToDest, g);
@@ -249,7 +321,8 @@ namespace ariel {
         return totalCost;
     }
 
-    std::vector<size_t> ShortestPath::buildShortestPath(const Graph &g, std::vector<int> &dist ,  size_t source ,size_t dest) {
+    template <typename DistArray>
+    std::vector<size_t> ShortestPath::buildShortestPath(const Graph &g, DistArray &dist ,  size_t source ,size_t dest) {
         // Build the shortest path vector
         std::vector<size_t> shortestPath;
         size_t currentVertex = dest;
@@ -257,7 +330,7 @@ namespace ariel {
             shortestPath.push_back(currentVertex);
             for (size_t u = 0; u < g.V(); ++u) {
                 int Edge_u_current =g.getEdgeWeight(u,size_t(currentVertex));
-                if (Edge_u_current != 0 &&
+                if (Edge_u_current != 0 && dist[u] != std::numeric_limits<int>::max() &&
                     dist[u] + Edge_u_current == dist[size_t(currentVertex)]) {
                     currentVertex = u;
                     break;
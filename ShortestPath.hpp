@@ -4,6 +4,10 @@
 #define SHORTEST_PATH_HPP
 
 #include "Graph.hpp"
+#include "BfsEngine.hpp"
+#include "DeltaStepping.hpp"
+#include "PriorityQueues.hpp"
+#include "Workspace.hpp"
 #include <stack>
 #include "iostream"
 #include <vector>
@@ -11,34 +15,149 @@
 #include <limits>
 #include <sstream>
 #include <algorithm>
+#include <map>
 
 namespace ariel {
+    // engine used for weighted graphs without negative edges
+    enum class WeightedEngine { AUTO, DIJKSTRA, DELTA_STEPPING };
+
     class ShortestPath {
     public:
-        static std::string Execute(const ariel::Graph &g, size_t source, size_t dest);
+        // the scratch arrays of the sequential engines come from workspace, the calling thread's one by default
+        static std::string Execute(const ariel::Graph &g, size_t source, size_t dest,
+                                   WeightedEngine engine = WeightedEngine::AUTO,
+                                   Workspace &workspace = Workspace::local());
+        // answers many (source, dest) queries, one single-source run per distinct source, results in query order
+        static std::vector<std::string> ExecuteBatch(const Graph &g, const std::vector<std::pair<size_t, size_t>> &queries,
+                                                     size_t threads = Parallel::numThreads());
+        // number of edges from every source to every vertex, one row per source
+        static std::vector<std::vector<int>> bfsDistances(const Graph &g, const std::vector<size_t> &sources);
+
+        // Dijkstra's distances from source with a pluggable priority queue (IndexedDaryHeap, RadixHeap, DialQueue)
+        // stops once dest is settled, INT_MAX for vertices that were not reached
+        template <typename Queue = IndexedDaryHeap<4>>
+        static std::vector<int> dijkstraDistances(const Graph &g, size_t source, size_t dest = BfsEngine::NO_VERTEX);
+
+        // distances from source to every vertex into workspace.dist, single threaded so callers can run a source
+        // per thread. the BFS engine on unweighted graphs and Dijkstra otherwise, both leave the reached vertices
+        // by distance in workspace.queue. the graph must not have negative edges
+        static void distances(const Graph &g, size_t source, Workspace &workspace);
+
+        // Dijkstra from source over a Graph or a graph view into workspace.dist, with the shortest path tree in
+        // workspace.predecessors (NO_VERTEX above the source and unreached vertices), stops once dest is settled.
+        // maxWeight bounds the edge weights of g and picks the queue like the Graph queries do
+        template <typename G>
+        static void dijkstraTree(const G &g, size_t source, size_t dest, int maxWeight, Workspace &workspace);
+
+        // Helper method to construct the shortest path as a string
+        static std::string constructPath(const std::vector<size_t>& path , size_t source,size_t dest);
 
     private:
 
-        static std::string bellmanFordSetUps(const Graph& g, size_t source, size_t dest);
+        static std::string bellmanFordSetUps(const Graph& g, size_t source, size_t dest, Workspace &workspace);
         // check weather the input is valid
         static bool isValidInput (const Graph& g, size_t source, size_t dest);
         // Dijkstra's algorithm for finding the shortest paths in weighted graphs
-        static std::vector<size_t> dijkstra(const Graph& g, size_t source, size_t dest);
+        static std::vector<size_t> dijkstra(const Graph& g, size_t source, size_t dest, Workspace &workspace);
 
-        // Bellman-Ford algorithm for finding the shortest paths, can handle graphs with negative weights
-        static std::vector<size_t> bellmanFord(const Graph& g, size_t source, size_t dest);
+        // Dijkstra's distances from source into workspace.dist, on the workspace's Dial or d-ary heap queue,
+        // with the settled vertices in settling order in workspace.queue
+        static void weightedDistances(const Graph& g, size_t source, size_t dest, Workspace &workspace);
 
-        // BFS for finding the shortest paths in unweighted graphs or checking graph connectivity
-        static std::vector<size_t> bfs(const Graph& g, size_t source, size_t dest);
+        // the parent array of the runs that only want distances, every write is dropped
+        struct NoParents {
+            size_t dropped;
+            size_t &operator[](size_t) { return dropped; }
+        };
 
-        // Helper method to construct the shortest path as a string
-        static std::string constructPath(const std::vector<size_t>& path , size_t source,size_t dest);
+        // the settled list of the runs that do not need the settling order, every vertex is dropped
+        struct NoOrder {
+            void push_back(size_t) {}
+        };
+
+        // Dijkstra's main loop over a Graph or a graph view, dist must hold INT_MAX for every vertex and queue must
+        // be empty, parents[v] receives the vertex v was last relaxed from and every vertex is appended to settled
+        // once its distance is final, so settled lists them by increasing distance
+        template <typename G, typename Queue, typename DistArray, typename ParentArray, typename SettledList>
+        static void dijkstraRun(const G& g, size_t source, size_t dest, Queue &queue, DistArray &dist,
+                                ParentArray &parents, SettledList &settled);
+
+        // parallel delta-stepping for large weighted graphs with non-negative weights
+        static std::vector<size_t> deltaStepping(const Graph& g, size_t source, size_t dest);
+
+        // Bellman-Ford algorithm for finding the shortest paths, can handle graphs with negative weights
+        static std::vector<size_t> bellmanFord(const Graph& g, size_t source, size_t dest, Workspace &workspace);
+
+        // BFS for finding the shortest paths in unweighted graphs, large graphs run on the direction-optimizing engine
+        static std::vector<size_t> bfs(const Graph& g, size_t source, size_t dest, Workspace &workspace);
 
         static int CalculatePathCost(std::vector<size_t> &path, const Graph &g);
 
-        static std::vector<size_t> buildShortestPath (const Graph& g,  std::vector<int>& dist , size_t source ,size_t dest);
+        // dist is a std::vector<int> or a StampedArray<int>
+        template <typename DistArray>
+        static std::vector<size_t> buildShortestPath (const Graph& g,  DistArray& dist , size_t source ,size_t dest);
+
+        template <typename DistArray>
+        static void answerQueries(const Graph &g, size_t source, DistArray &dist, const std::vector<size_t> &indices,
+                                  const std::vector<std::pair<size_t, size_t>> &queries,
+                                  std::vector<std::string> &answers);
 
     };
+
+    template <typename Queue>
+    std::vector<int> ShortestPath::dijkstraDistances(const Graph &g, size_t source, size_t dest) {
+        // init the distance array to infinity for each vertex
+        std::vector<int> dist(g.V(), std::numeric_limits<int>::max());
+        Queue queue(g.V(), g.getMaxWeight());
+        NoParents parents;
+        NoOrder settled;
+        dijkstraRun(g, source, dest, queue, dist, parents, settled);
+        return dist;
+    }
+
+    template <typename G>
+    void ShortestPath::dijkstraTree(const G &g, size_t source, size_t dest, int maxWeight, Workspace &workspace) {
+        workspace.dist.reset(g.V(), std::numeric_limits<int>::max());
+        workspace.predecessors.reset(g.V(), BfsEngine::NO_VERTEX);
+        NoOrder settled;
+        if (maxWeight <= MAX_WEIGHT) {
+            workspace.dial.reset(g.V(), maxWeight);
+            dijkstraRun(g, source, dest, workspace.dial, workspace.dist, workspace.predecessors, settled);
+        } else {
+            workspace.heap.reset(g.V(), maxWeight);
+            dijkstraRun(g, source, dest, workspace.heap, workspace.dist, workspace.predecessors, settled);
+        }
+    }
+
+    template <typename G, typename Queue, typename DistArray, typename ParentArray, typename SettledList>
+    void ShortestPath::dijkstraRun(const G &g, size_t source, size_t dest, Queue &queue, DistArray &dist,
+                                   ParentArray &parents, SettledList &settled) {
+        dist[source] = 0;
+        queue.push(source, 0);
+
+        while (!queue.empty()) {
+            //extract the vertex with the min distance
+            std::pair<int, size_t> top = queue.pop();
+            size_t u = top.second;
+            // skip outdated entries left behind by lazy queues, a vertex is only pushed when its distance drops
+            // so the entry that matches dist[u] is the one that settles it
+            if (top.first != dist[u])
+                continue;
+            settled.push_back(u);
+            if (u == dest)
+                break;
+
+            // relax all the adj of u if necessary, settled vertices never improve since the weights are positive
+            int dist_u = dist[u];
+            g.forEachNeighbor(u, [&](size_t v, int weight_uv) {
+                if (dist[v] > dist_u + weight_uv) {
+                    dist[v] = dist_u + weight_uv;
+                    parents[v] = u;
+                    queue.push(v, dist[v]);
+                }
+            });
+        }
+    }
 }
 
 #endif // SHORTEST_PATH_HPP
\ No newline at end of file
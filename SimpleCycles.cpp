@@ -0,0 +1,150 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "SimpleCycles.hpp"
+#include <algorithm>
+
+namespace ariel {
+
+    /**
+     * Enumerates the simple cycles of the graph with Johnson's algorithm.
+     * for every root vertex in increasing order, the cycles through it that use only larger vertices are found by
+     * a depth first search inside the root's strongly connected component. a vertex that failed to lead back to
+     * the root stays blocked until one of its successors gets unblocked, so no work is repeated between two
+     * cycles and the enumeration costs O((V + E) * (cycles + 1)).
+     * @param g The graph.
+     * @param visit Called with each cycle, returns false to stop the enumeration.
+     * @return The number of cycles passed to visit.
+     */
+    size_t SimpleCycles::enumerate(const Graph &g, const Visitor &visit) {
+        Search search(g, visit);
+        return search.run();
+    }
+
+    /**
+     * Enumerates the simple cycles of negative total weight.
+     * @param g The graph.
+     * @param visit Called with each negative cycle, returns false to stop the enumeration.
+     * @return The number of cycles passed to visit.
+     */
+    size_t SimpleCycles::enumerateNegative(const Graph &g, const Visitor &visit) {
+        if (g.getEdgeNegativity() == EdgeNegativity::NONE)
+            return 0;
+        size_t reported = 0;
+        enumerate(g, [&](const std::vector<size_t> &cycle) {
+            long long weight = 0;
+            for (size_t i = 0; i < cycle.size(); ++i)
+                weight += g.getEdgeWeight(cycle[i], cycle[(i + 1) % cycle.size()]);
+            if (weight >= 0)
+                return true;
+            reported++;
+            return visit(cycle);
+        });
+        return reported;
+    }
+
+    SimpleCycles::Search::Search(const Graph &g, const Visitor &visit)
+            : g(g), visit(visit), undirected(g.getGraphType() == GraphType::UNDIRECTED), stopped(false),
+              reported(0), root(0), incoming(g.V()), inComponent(g.V(), 0), blocked(g.V(), 0), blockedBy(g.V()) {
+        for (size_t u = 0; u < g.V(); ++u) {
+            for (size_t v : g.neighbors(u))
+                incoming[v].push_back(u);
+        }
+    }
+
+    size_t SimpleCycles::Search::run() {
+        for (root = 0; root < g.V() && !stopped; ++root) {
+            if (!findComponent())
+                continue;
+            for (size_t v = root; v < g.V(); ++v) {
+                blocked[v] = 0;
+                blockedBy[v].clear();
+            }
+            circuit(root);
+        }
+        return reported;
+    }
+
+    // forward and backward reachability from root among the vertices >= root, their intersection is the component
+    bool SimpleCycles::Search::findComponent() {
+        std::vector<char> forward(g.V(), 0);
+        std::vector<size_t> queue(1, root);
+        forward[root] = 1;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            for (size_t v : g.neighbors(queue[head])) {
+                if (v > root && !forward[v]) {
+                    forward[v] = 1;
+                    queue.push_back(v);
+                }
+            }
+        }
+
+        std::fill(inComponent.begin(), inComponent.end(), 0);
+        inComponent[root] = 1;
+        queue.assign(1, root);
+        size_t size = 1;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            for (size_t u : incoming[queue[head]]) {
+                if (u > root && forward[u] && !inComponent[u]) {
+                    inComponent[u] = 1;
+                    queue.push_back(u);
+                    size++;
+                }
+            }
+        }
+        // a single vertex only has a cycle through a self-loop
+        return size > 1 || g.getEdgeWeight(root, root) != 0;
+    }
+
+    // finds the cycles that extend the current stack through v, true if any was found
+    bool SimpleCycles::Search::circuit(size_t v) {
+        bool found = false;
+        stack.push_back(v);
+        blocked[v] = 1;
+
+        for (size_t w : g.neighbors(v)) {
+            if (stopped)
+                break;
+            if (!inComponent[w])
+                continue;
+            if (w == root) {
+                report();
+                found = true;
+            } else if (!blocked[w] && circuit(w)) {
+                found = true;
+            }
+        }
+
+        if (found) {
+            unblock(v);
+        } else {
+            // v stays blocked until one of its successors is unblocked
+            for (size_t w : g.neighbors(v)) {
+                if (inComponent[w] && std::find(blockedBy[w].begin(), blockedBy[w].end(), v) == blockedBy[w].end())
+                    blockedBy[w].push_back(v);
+            }
+        }
+        stack.pop_back();
+        return found;
+    }
+
+    void SimpleCycles::Search::unblock(size_t u) {
+        blocked[u] = 0;
+        while (!blockedBy[u].empty()) {
+            size_t w = blockedBy[u].back();
+            blockedBy[u].pop_back();
+            if (blocked[w])
+                unblock(w);
+        }
+    }
+
+    void SimpleCycles::Search::report() {
+        if (undirected) {
+            // an edge walked there and back is not a cycle, and every cycle is kept in one direction only
+            if (stack.size() == 2 || (stack.size() > 2 && stack[1] > stack.back()))
+                return;
+        }
+        reported++;
+        if (!visit(stack))
+            stopped = true;
+    }
+}
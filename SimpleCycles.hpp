@@ -0,0 +1,57 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef SIMPLE_CYCLES_HPP
+#define SIMPLE_CYCLES_HPP
+
+#include "Graph.hpp"
+#include <functional>
+#include <vector>
+
+namespace ariel {
+    /**
+     * Johnson's enumeration of all simple cycles, streamed to a callback one cycle at a time.
+     * a cycle is handed over as its vertices in edge order starting from its smallest vertex, and the callback
+     * returns false to stop the enumeration, so callers can cap the count or the time.
+     * the memory stays O(V + E) however many cycles the graph has.
+     * in undirected graphs an edge is not a cycle by itself and every cycle is reported in one direction only.
+     */
+    class SimpleCycles {
+    public:
+        typedef std::function<bool(const std::vector<size_t> &)> Visitor;
+
+        // every simple cycle, returns the number of cycles passed to visit
+        static size_t enumerate(const Graph &g, const Visitor &visit);
+
+        // only the cycles of negative total weight
+        static size_t enumerateNegative(const Graph &g, const Visitor &visit);
+
+    private:
+        // the state of one enumeration, the circuits rooted at each vertex in turn
+        class Search {
+        public:
+            Search(const Graph &g, const Visitor &visit);
+            size_t run();
+
+        private:
+            const Graph &g;
+            const Visitor &visit;
+            bool undirected;
+            bool stopped;
+            size_t reported;
+            size_t root;
+            std::vector<std::vector<size_t>> incoming;
+            std::vector<char> inComponent;
+            std::vector<char> blocked;
+            std::vector<std::vector<size_t>> blockedBy;
+            std::vector<size_t> stack;
+
+            // marks the strongly connected component of root among the vertices >= root, false if it has no cycle
+            bool findComponent();
+            bool circuit(size_t v);
+            void unblock(size_t u);
+            void report();
+        };
+    };
+}
+
+#endif // SIMPLE_CYCLES_HPP
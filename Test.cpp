@@ -3,8 +3,39 @@
 #include "doctest.h"
 #include "Algorithms.hpp"
 #include "Graph.hpp"
+#include <set>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <atomic>
+#include <mutex>
 
 using namespace std;
+
+// the pseudo random sequence of the randomized tests, a linear congruential generator on seed
+static unsigned nextRandom(unsigned &seed) {
+    seed = seed * 1103515245u + 12345u;
+    return (seed >> 16) & 0x7fff;
+}
+
+// a random adjacency matrix of n vertices drawn from seed: every pair of distinct vertices, and every vertex with
+// itself when loops is set, gets an edge with probability 1 / density and a weight in [minWeight, maxWeight], a
+// weight of 0 leaves the pair without an edge. an undirected matrix is symmetric
+static vector<vector<int>> randomMatrix(unsigned &seed, size_t n, unsigned density, bool directed, int maxWeight,
+                                        int minWeight = 1, bool loops = false) {
+    vector<vector<int>> matrix(n, vector<int>(n, 0));
+    for (size_t u = 0; u < n; ++u) {
+        for (size_t v = directed ? 0 : u; v < n; ++v) {
+            if ((u == v && !loops) || nextRandom(seed) % density != 0)
+                continue;
+            int weight = minWeight + int(nextRandom(seed) % unsigned(maxWeight - minWeight + 1));
+            matrix[u][v] = weight;
+            if (!directed)
+                matrix[v][u] = weight;
+        }
+    }
+    return matrix;
+}
 TEST_CASE("Tests Algorithms") {
     ariel::Graph g1;
     // connected graph 
@@ -375,3 +406,1587 @@ TEST_CASE("Invalid operations")
     // subtraction of two graphs with different dimensions
     CHECK_THROWS(g1-g6);
 }
+
+TEST_CASE("Parallel connected components")
+{
+    // two components {0,1,2} and {3,4}, vertex 5 is isolated
+    ariel::Graph g1;
+    vector<vector<int>> graph = {
+            {0, 1, 0, 0, 0, 0},
+            {1, 0, 1, 0, 0, 0},
+            {0, 1, 0, 0, 0, 0},
+            {0, 0, 0, 0, 3, 0},
+            {0, 0, 0, 3, 0, 0},
+            {0, 0, 0, 0, 0, 0}};
+    g1.loadGraph(graph);
+
+    // the labels are the smallest vertex of each component regardless of the number of threads
+    vector<size_t> expected = {0, 0, 0, 3, 3, 5};
+    CHECK(ariel::ConnectedComponents::Execute(g1, 1) == expected);
+    CHECK(ariel::ConnectedComponents::Execute(g1, 4) == expected);
+    CHECK(ariel::ConnectedComponents::countComponents(expected) == 3);
+
+    // a ring larger than the parallel threshold goes through the components engine
+    size_t n = PARALLEL_THRESHOLD + 1;
+    vector<vector<int>> ring(n, vector<int>(n, 0));
+    for (size_t i = 0; i < n; ++i) {
+        ring[i][(i + 1) % n] = 1;
+        ring[(i + 1) % n][i] = 1;
+    }
+    ariel::Graph g2;
+    g2.loadGraph(ring);
+    CHECK(ariel::Algorithms::isConnected(g2) == true);
+
+    // cutting the ring in two places splits it into two components
+    ring[0][1] = ring[1][0] = 0;
+    ring[n / 2][n / 2 + 1] = ring[n / 2 + 1][n / 2] = 0;
+    g2.loadGraph(ring);
+    CHECK(ariel::Algorithms::isConnected(g2) == false);
+    CHECK(ariel::ConnectedComponents::countComponents(ariel::ConnectedComponents::Execute(g2)) == 2);
+}
+
+TEST_CASE("Direction-optimizing BFS")
+{
+    // a star around 0 with a tail 5->6->7, the large frontier is expanded bottom-up
+    ariel::Graph g1;
+    vector<vector<int>> graph = {
+            {0, 1, 1, 1, 1, 1, 0, 0},
+            {1, 0, 0, 0, 0, 0, 0, 0},
+            {1, 0, 0, 0, 0, 0, 0, 0},
+            {1, 0, 0, 0, 0, 0, 0, 0},
+            {1, 0, 0, 0, 0, 0, 0, 0},
+            {1, 0, 0, 0, 0, 0, 1, 0},
+            {0, 0, 0, 0, 0, 1, 0, 1},
+            {0, 0, 0, 0, 0, 0, 1, 0}};
+    g1.loadGraph(graph);
+    CHECK(ariel::Algorithms::shortestPath(g1, 1, 7) == "Shortest path from 1 to 7 is: 1->0->5->6->7");
+    vector<int> expected = {1, 0, 2, 2, 2, 2, 3, 4};
+    CHECK(ariel::BfsEngine::distances(g1, 1) == expected);
+
+    // a long directed path keeps the frontier small, so it is expanded top-down
+    size_t n = 60;
+    vector<vector<int>> path(n, vector<int>(n, 0));
+    for (size_t i = 0; i + 1 < n; ++i)
+        path[i][i + 1] = 1;
+    ariel::Graph g2;
+    g2.loadGraph(path);
+    vector<int> dist = ariel::BfsEngine::distances(g2, 0);
+    CHECK(dist[n - 1] == int(n - 1));
+    CHECK(ariel::BfsEngine::distances(g2, 1)[0] == std::numeric_limits<int>::max());
+    CHECK(ariel::Algorithms::shortestPath(g2, 5, 0) == "There is no path from 5 to 0");
+
+    // the traversal on workspace storage matches, dense undirected graphs go bottom-up, and the same workspace
+    // is reused for every query
+    ariel::Workspace workspace;
+    unsigned seed = 99;
+    bool same = true, ordered = true;
+    for (int round = 0; round < 40; ++round) {
+        size_t size = 5 + nextRandom(seed) % 60;
+        bool directed = round % 2 == 1;
+        unsigned density = 2 + nextRandom(seed) % 8;
+        g2.loadGraph(randomMatrix(seed, size, density, directed, 1));
+        size_t source = nextRandom(seed) % size;
+        vector<int> reference = ariel::BfsEngine::distances(g2, source);
+        ariel::BfsEngine::distances(g2, source, ariel::BfsEngine::NO_VERTEX, workspace);
+        for (size_t v = 0; v < size; ++v)
+            same = same && workspace.dist[v] == reference[v];
+        for (size_t i = 1; i < workspace.queue.size(); ++i)
+            ordered = ordered && workspace.dist[workspace.queue[i - 1]] <= workspace.dist[workspace.queue[i]];
+
+        // a query that stops at dest still has its distance right
+        size_t dest = nextRandom(seed) % size;
+        ariel::BfsEngine::distances(g2, source, dest, workspace);
+        same = same && workspace.dist[dest] == reference[dest];
+    }
+    CHECK(same);
+    CHECK(ordered);
+}
+
+TEST_CASE("Multi-source BFS distances")
+{
+    ariel::Graph g1;
+    vector<vector<int>> graph = {
+            {0, 1, 0, 0, 0},
+            {1, 0, 1, 0, 0},
+            {0, 1, 0, 1, 0},
+            {0, 0, 1, 0, 0},
+            {0, 0, 0, 0, 0}};
+    g1.loadGraph(graph);
+    int inf = std::numeric_limits<int>::max();
+    vector<vector<int>> rows = ariel::Algorithms::bfsDistances(g1, {0, 3, 4});
+    CHECK(rows[0] == vector<int>({0, 1, 2, 3, inf}));
+    CHECK(rows[1] == vector<int>({3, 2, 1, 0, inf}));
+    CHECK(rows[2] == vector<int>({inf, inf, inf, inf, 0}));
+
+    // more than 64 sources are split into several batches, each row matches a single bfs
+    size_t n = 70;
+    vector<vector<int>> ring(n, vector<int>(n, 0));
+    for (size_t i = 0; i < n; ++i)
+        ring[i][(i + 1) % n] = 1;
+    ariel::Graph g2;
+    g2.loadGraph(ring);
+    vector<size_t> sources;
+    for (size_t i = 0; i < n; ++i)
+        sources.push_back(i);
+    rows = ariel::Algorithms::bfsDistances(g2, sources);
+    bool allMatch = true;
+    for (size_t i = 0; i < n; ++i)
+        allMatch = allMatch && rows[i] == ariel::BfsEngine::distances(g2, i);
+    CHECK(allMatch);
+    CHECK(rows[65][64] == int(n - 1));
+
+    CHECK_THROWS(ariel::Algorithms::bfsDistances(g1, {5}));
+}
+
+TEST_CASE("Parallel level-synchronous BFS")
+{
+    ariel::Graph g1;
+    vector<vector<int>> graph = {
+            {0, 1, 1, 0, 0, 0},
+            {1, 0, 0, 1, 0, 0},
+            {1, 0, 0, 1, 0, 0},
+            {0, 1, 1, 0, 1, 0},
+            {0, 0, 0, 1, 0, 0},
+            {0, 0, 0, 0, 0, 0}};
+    g1.loadGraph(graph);
+    int inf = std::numeric_limits<int>::max();
+    vector<int> expected = {0, 1, 1, 2, 3, inf};
+    CHECK(ariel::BfsEngine::distances(g1, 0, ariel::BfsEngine::NO_VERTEX, 4) == expected);
+
+    // an even ring above the parallel threshold is bipartite, an odd one is not
+    size_t n = PARALLEL_THRESHOLD + 2;
+    vector<vector<int>> ring(n, vector<int>(n, 0));
+    for (size_t i = 0; i < n; ++i) {
+        ring[i][(i + 1) % n] = 1;
+        ring[(i + 1) % n][i] = 1;
+    }
+    ariel::Graph g2;
+    g2.loadGraph(ring);
+    CHECK(ariel::Algorithms::isBipartite(g2).find("Graph is bipartite, A={0,2,4,") == 0);
+    CHECK(ariel::Algorithms::shortestPath(g2, 0, n - 2) == "Shortest path from 0 to " + std::to_string(n - 2) +
+                                                           " is: 0->" + std::to_string(n - 1) + "->" + std::to_string(n - 2));
+
+    ring[0][n - 1] = ring[n - 1][0] = 0;
+    ring[0][n - 2] = ring[n - 2][0] = 1;
+    g2.loadGraph(ring);
+    CHECK(ariel::Algorithms::isBipartite(g2) == "Graph is not bipartite");
+
+    // many paths of three vertices above the threshold, the levels restart at the first vertex of every path
+    vector<vector<int>> paths(n, vector<int>(n, 0));
+    for (size_t v = 0; v + 2 < n; v += 3) {
+        paths[v][v + 1] = paths[v + 1][v] = 1;
+        paths[v + 1][v + 2] = paths[v + 2][v + 1] = 1;
+    }
+    ariel::Graph g3;
+    g3.loadGraph(paths);
+    ariel::Workspace workspace;
+    ariel::BfsEngine::componentLevels(g3, 4, workspace);
+    bool sameLevels = true;
+    for (size_t v = 0; v < n; ++v)
+        sameLevels = sameLevels && workspace.dist[v] == ariel::BfsEngine::distances(g3, v - v % 3)[v];
+    CHECK(sameLevels);
+    CHECK(ariel::Algorithms::isBipartite(g3).find("Graph is bipartite, A={0,2,3,5,") == 0);
+    paths[0][2] = paths[2][0] = 1;
+    g3.loadGraph(paths);
+    CHECK(ariel::Algorithms::isBipartite(g3) == "Graph is not bipartite");
+}
+
+TEST_CASE("Persistent thread pool")
+{
+    // many short parallel loops in a row, as the BFS levels run them
+    std::atomic<size_t> sum(0);
+    for (size_t round = 0; round < 500; ++round)
+        ariel::Parallel::forEach(0, 64, 4, [&](size_t, size_t i) { sum += i; }, 1);
+    CHECK(sum.load() == 500 * 2016);
+
+    // the workers keep their thread_local storage from one call to the next
+    vector<const ariel::Workspace *> first(4, nullptr);
+    bool same = true;
+    std::mutex lock;
+    for (size_t round = 0; round < 20; ++round) {
+        ariel::Parallel::forEach(0, 4, 4, [&](size_t thread, size_t) {
+            std::lock_guard<std::mutex> guard(lock);
+            if (first[thread] == nullptr)
+                first[thread] = &ariel::Workspace::local();
+            same = same && first[thread] == &ariel::Workspace::local();
+        }, 1);
+    }
+    CHECK(same);
+
+    // a nested loop runs in the worker that called it
+    std::atomic<size_t> inner(0);
+    ariel::Parallel::forEach(0, 8, 4, [&](size_t, size_t) {
+        ariel::Parallel::forEach(0, 10, 4, [&](size_t, size_t) { ++inner; }, 1);
+    }, 1);
+    CHECK(inner.load() == 80);
+
+    CHECK_THROWS_AS(ariel::Parallel::forEach(0, 100, 4, [](size_t, size_t i) {
+        if (i == 57)
+            throw std::invalid_argument("index 57");
+    }, 1), std::invalid_argument);
+    sum = 0;
+    ariel::Parallel::forEach(0, 64, 4, [&](size_t, size_t i) { sum += i; }, 1);
+    CHECK(sum.load() == 2016);
+}
+
+TEST_CASE("Delta-stepping shortest paths")
+{
+    vector<vector<int>> graph9 = {
+            {0, 9, 0, 2, 0},
+            {9, 0, 3, 0, 0},
+            {0, 3, 0, 0, 4},
+            {2, 0, 0, 0, 0},
+            {0, 0, 4, 0, 0}};
+    ariel::Graph g1;
+    g1.loadGraph(graph9);
+    CHECK(ariel::Algorithms::shortestPath(g1, 0, 4, ariel::WeightedEngine::DELTA_STEPPING) ==
+          "Shortest path from 0 to 4 is: 0->1->2->4");
+    CHECK(ariel::Algorithms::shortestPath(g1, 3, 2, ariel::WeightedEngine::DELTA_STEPPING) ==
+          ariel::Algorithms::shortestPath(g1, 3, 2, ariel::WeightedEngine::DIJKSTRA));
+
+    // a pseudo random directed graph, every bucket width and thread count gives the same distances
+    size_t n = 40;
+    unsigned seed = 12345;
+    ariel::Graph g2;
+    g2.loadGraph(randomMatrix(seed, n, 5, true, 50));
+    vector<int> reference = ariel::DeltaStepping::distances(g2, 0, 1000, 1);
+    CHECK(ariel::DeltaStepping::distances(g2, 0, 1, 1) == reference);
+    CHECK(ariel::DeltaStepping::distances(g2, 0, 7, 4) == reference);
+    CHECK(ariel::DeltaStepping::distances(g2, 0) == reference);
+    // the vertices are split between any number of owners, each relaxing its own requests
+    bool sameDistances = true;
+    for (size_t source = 0; source < n; source += 7) {
+        vector<int> exact = ariel::ShortestPath::dijkstraDistances(g2, source);
+        for (size_t threads = 2; threads <= 8; threads += 3)
+            sameDistances = sameDistances && ariel::DeltaStepping::distances(g2, source, 5, threads) == exact;
+    }
+    CHECK(sameDistances);
+    bool samePaths = true;
+    for (size_t v = 1; v < n; ++v) {
+        samePaths = samePaths && ariel::Algorithms::shortestPath(g2, 0, v, ariel::WeightedEngine::DELTA_STEPPING) ==
+                                 ariel::Algorithms::shortestPath(g2, 0, v, ariel::WeightedEngine::DIJKSTRA);
+    }
+    CHECK(samePaths);
+}
+
+TEST_CASE("Dijkstra priority queue policies")
+{
+    // a pseudo random directed graph with weights above MAX_WEIGHT in some edges
+    size_t n = 50;
+    unsigned seed = 777;
+    ariel::Graph g;
+    g.loadGraph(randomMatrix(seed, n, 6, true, 1500));
+    CHECK(g.getMaxWeight() > MAX_WEIGHT);
+
+    vector<int> reference = ariel::DeltaStepping::distances(g, 0, 0, 1);
+    CHECK(ariel::ShortestPath::dijkstraDistances(g, 0) == reference);
+    CHECK(ariel::ShortestPath::dijkstraDistances<ariel::IndexedDaryHeap<2>>(g, 0) == reference);
+    CHECK(ariel::ShortestPath::dijkstraDistances<ariel::RadixHeap>(g, 0) == reference);
+    CHECK(ariel::ShortestPath::dijkstraDistances<ariel::DialQueue>(g, 0) == reference);
+
+    // stopping at the destination leaves its distance final
+    CHECK(ariel::ShortestPath::dijkstraDistances<ariel::DialQueue>(g, 0, 17)[17] == reference[17]);
+
+    // the radix heap rejects keys below the last extracted one
+    ariel::RadixHeap heap(3, 0);
+    heap.push(0, 5);
+    heap.push(1, 9);
+    CHECK(heap.pop() == std::make_pair(5, size_t(0)));
+    CHECK_THROWS(heap.push(2, 4));
+}
+
+TEST_CASE("A* with ALT landmarks")
+{
+    // a 6x6 grid with weighted horizontal and vertical roads
+    size_t side = 6, n = side * side;
+    vector<vector<int>> grid(n, vector<int>(n, 0));
+    for (size_t r = 0; r < side; ++r) {
+        for (size_t c = 0; c < side; ++c) {
+            size_t v = r * side + c;
+            if (c + 1 < side)
+                grid[v][v + 1] = grid[v + 1][v] = int((r * 7 + c * 3) % 5) + 1;
+            if (r + 1 < side)
+                grid[v][v + side] = grid[v + side][v] = int((r * 2 + c * 5) % 4) + 2;
+        }
+    }
+    ariel::Graph g;
+    g.loadGraph(grid);
+    ariel::Landmarks landmarks(g, 3);
+    CHECK(landmarks.getLandmarks().size() == 3);
+
+    // the landmark bounds never overestimate and A* finds paths as short as Dijkstra's
+    // every query reuses one workspace
+    vector<int> exact = ariel::ShortestPath::dijkstraDistances(g, 0);
+    ariel::Workspace workspace;
+    bool admissible = true, optimal = true;
+    for (size_t v = 0; v < n; ++v) {
+        admissible = admissible && landmarks.lowerBound(0, v) <= exact[v];
+        vector<size_t> path = ariel::AStar::search(g, 0, v, [&](size_t u) { return landmarks.lowerBound(u, v); },
+                                                   workspace);
+        int cost = 0;
+        for (size_t i = 0; i + 1 < path.size(); ++i)
+            cost += g.getEdgeWeight(path[i], path[i + 1]);
+        optimal = optimal && (v == 0 || cost == exact[v]);
+    }
+    CHECK(admissible);
+    CHECK(optimal);
+
+    vector<vector<int>> graph = {
+            {0, 4, 1, 0},
+            {0, 0, 0, 1},
+            {0, 2, 0, 6},
+            {0, 0, 0, 0}};
+    ariel::Graph g2;
+    g2.loadGraph(graph);
+    ariel::Landmarks landmarks2(g2);
+    CHECK(ariel::Algorithms::shortestPath(g2, 0, 3, landmarks2) == "Shortest path from 0 to 3 is: 0->2->1->3");
+    CHECK(ariel::Algorithms::shortestPath(g2, 3, 0, landmarks2) == "There is no path from 3 to 0");
+    CHECK_THROWS(ariel::Algorithms::shortestPath(g, 0, 3, landmarks2));
+
+    // h is admissible but not consistent: 3 is first reached through 1 at cost 4, then through 2 at cost 2
+    vector<vector<int>> reopen = {
+            {0, 1, 1, 0, 0},
+            {0, 0, 0, 3, 0},
+            {0, 0, 0, 1, 0},
+            {0, 0, 0, 0, 5},
+            {0, 0, 0, 0, 0}};
+    g2.loadGraph(reopen);
+    vector<int> h = {0, 0, 5, 0, 0};
+    CHECK(ariel::AStar::search(g2, 0, 4, [&](size_t u) { return h[u]; }) == vector<size_t>({0, 2, 3, 4}));
+    CHECK(ariel::AStar::search(g2, 0, 4, [&](size_t u) { return h[u]; }, workspace) == vector<size_t>({0, 2, 3, 4}));
+}
+
+TEST_CASE("Contraction hierarchies")
+{
+    // a pseudo random directed graph, every query of the hierarchy matches Dijkstra
+    size_t n = 30;
+    unsigned seed = 4242;
+    ariel::Graph g;
+    g.loadGraph(randomMatrix(seed, n, 7, true, 20));
+    ariel::ContractionHierarchy ch(g);
+
+    bool sameDistances = true, validPaths = true;
+    for (size_t s = 0; s < n; ++s) {
+        vector<int> exact = ariel::ShortestPath::dijkstraDistances(g, s);
+        for (size_t t = 0; t < n; ++t) {
+            sameDistances = sameDistances && ch.distance(s, t) == exact[t];
+            vector<size_t> path = ch.path(s, t);
+            if (exact[t] == std::numeric_limits<int>::max()) {
+                validPaths = validPaths && path.empty();
+                continue;
+            }
+            // the unpacked path uses original edges only and has the shortest length
+            int cost = 0;
+            for (size_t i = 0; i + 1 < path.size(); ++i) {
+                validPaths = validPaths && g.getEdgeWeight(path[i], path[i + 1]) != 0;
+                cost += g.getEdgeWeight(path[i], path[i + 1]);
+            }
+            validPaths = validPaths && path.front() == s && path.back() == t && cost == exact[t];
+        }
+    }
+    CHECK(sameDistances);
+    CHECK(validPaths);
+
+    vector<vector<int>> graph9 = {
+            {0, 9, 0, 2, 0},
+            {9, 0, 3, 0, 0},
+            {0, 3, 0, 0, 4},
+            {2, 0, 0, 0, 0},
+            {0, 0, 4, 0, 0}};
+    ariel::Graph g2;
+    g2.loadGraph(graph9);
+    ariel::ContractionHierarchy ch2(g2);
+    CHECK(ch2.query(0, 4) == "Shortest path from 0 to 4 is: 0->1->2->4");
+    CHECK(ch2.query(4, 3) == "Shortest path from 4 to 3 is: 4->2->1->0->3");
+    CHECK_THROWS((void) ch2.distance(0, 5));
+}
+
+TEST_CASE("Batched shortest path queries")
+{
+    vector<vector<int>> graph9 = {
+            {0, 9, 0, 2, 0},
+            {9, 0, 3, 0, 0},
+            {0, 3, 0, 0, 4},
+            {2, 0, 0, 0, 0},
+            {0, 0, 4, 0, 0}};
+    ariel::Graph g;
+    g.loadGraph(graph9);
+
+    // every answer matches the single query api, whatever the order and grouping of the queries
+    vector<std::pair<size_t, size_t>> queries = {{0, 4}, {3, 2}, {0, 2}, {4, 4}, {3, 1}, {0, 4}};
+    vector<string> answers = ariel::Algorithms::shortestPaths(g, queries);
+    bool sameAnswers = answers.size() == queries.size();
+    for (size_t i = 0; i < queries.size() && sameAnswers; ++i)
+        sameAnswers = answers[i] == ariel::Algorithms::shortestPath(g, queries[i].first, queries[i].second);
+    CHECK(sameAnswers);
+    CHECK(answers[0] == "Shortest path from 0 to 4 is: 0->1->2->4");
+    CHECK(answers[3] == "There is no path from 4 to 4");
+
+    // unweighted and negative graphs go through the same api
+    vector<vector<int>> graph1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}};
+    g.loadGraph(graph1);
+    CHECK(ariel::Algorithms::shortestPaths(g, {{0, 2}, {2, 0}}) ==
+          vector<string>({"Shortest path from 0 to 2 is: 0->1->2", "Shortest path from 2 to 0 is: 2->1->0"}));
+    vector<vector<int>> graph3 = {
+            {0, 1, 0, 0, 0},
+            {0, 0, -5, 0, 0},
+            {2, 0, 0, 0, 0},
+            {0, 0, 0, 0, 2},
+            {0, 0, 0, 0, 0}};
+    g.loadGraph(graph3);
+    CHECK_THROWS(ariel::Algorithms::shortestPaths(g, {{3, 4}, {0, 2}}));
+    CHECK_THROWS(ariel::Algorithms::shortestPaths(g, {{0, 7}}));
+
+    // many sources on a few threads, every worker reuses its workspace from one source to the next
+    size_t n = 40;
+    unsigned seed = 17;
+    for (int weighted = 0; weighted < 2; ++weighted) {
+        g.loadGraph(randomMatrix(seed, n, 8, true, weighted ? 9 : 1));
+        vector<std::pair<size_t, size_t>> many;
+        for (size_t i = 0; i < 300; ++i)
+            many.push_back(std::make_pair(size_t(nextRandom(seed) % n), size_t(nextRandom(seed) % n)));
+        vector<string> batch = ariel::ShortestPath::ExecuteBatch(g, many, 3);
+        bool same = true;
+        for (size_t i = 0; i < many.size(); ++i)
+            same = same && batch[i] == ariel::Algorithms::shortestPath(g, many[i].first, many[i].second);
+        CHECK(same);
+    }
+}
+
+TEST_CASE("Reusable algorithm workspaces")
+{
+    // a reset array reads as its fill value, whatever it held before
+    ariel::StampedArray<int> array;
+    array.reset(4, -1);
+    array[2] = 7;
+    CHECK(array[2] == 7);
+    CHECK(array[3] == -1);
+    array.reset(6, 0);
+    CHECK(array.size() == 6);
+    CHECK(array[2] == 0);
+    CHECK(array[5] == 0);
+
+    // one workspace serves graphs of different sizes and types, one after the other
+    ariel::Workspace workspace;
+    ariel::Graph g;
+    vector<vector<int>> graph9 = {
+            {0, 9, 0, 2, 0},
+            {9, 0, 3, 0, 0},
+            {0, 3, 0, 0, 4},
+            {2, 0, 0, 0, 0},
+            {0, 0, 4, 0, 0}};
+    g.loadGraph(graph9);
+    CHECK(ariel::ShortestPath::Execute(g, 0, 4, ariel::WeightedEngine::AUTO, workspace) ==
+          "Shortest path from 0 to 4 is: 0->1->2->4");
+    CHECK(ariel::IsBipartite::Execute(g, workspace) == "Graph is bipartite, A={0,2}, B={1,3,4}");
+
+    vector<vector<int>> graph3 = {
+            {0, 1, 0},
+            {0, 0, -5},
+            {2, 0, 0}};
+    g.loadGraph(graph3);
+    CHECK(ariel::DetectNegativeCycle::Execute(g, workspace) == "Negative cycle found: 0 -> 1 -> 2 -> 0");
+
+    vector<vector<int>> graph4 = {
+            {0, 4, 0, 0},
+            {0, 0, -2, 0},
+            {0, 0, 0, 3},
+            {0, 0, 0, 0}};
+    g.loadGraph(graph4);
+    CHECK(ariel::ShortestPath::Execute(g, 0, 3, ariel::WeightedEngine::AUTO, workspace) ==
+          "Shortest path from 0 to 3 is: 0->1->2->3");
+    CHECK(ariel::IsBipartite::Execute(g, workspace) == ariel::Algorithms::isBipartite(g));
+
+    // the same queries through the thread's own workspace give the same answers
+    g.loadGraph(graph9);
+    CHECK(ariel::Algorithms::shortestPath(g, 0, 4) == "Shortest path from 0 to 4 is: 0->1->2->4");
+    CHECK(ariel::Algorithms::shortestPath(g, 3, 4) == "Shortest path from 3 to 4 is: 3->0->1->2->4");
+}
+
+TEST_CASE("Epoch-stamped visited sets")
+{
+    ariel::VisitedSet visited;
+    visited.clear(3);
+    CHECK(visited.insert(1));
+    CHECK_FALSE(visited.insert(1));
+    CHECK(visited.contains(1));
+    CHECK_FALSE(visited.contains(0));
+    // a new generation forgets the old marks
+    visited.clear(5);
+    CHECK_FALSE(visited.contains(1));
+    CHECK(visited.size() == 5);
+
+    // traversals sharing one workspace do not see each other's marks
+    ariel::Workspace workspace;
+    ariel::Graph g;
+    vector<vector<int>> connected = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}};
+    vector<vector<int>> split = {
+            {0, 1, 0, 0},
+            {1, 0, 0, 0},
+            {0, 0, 0, 1},
+            {0, 0, 1, 0}};
+    vector<vector<int>> directed = {
+            {0, 1, 0},
+            {0, 0, 1},
+            {1, 0, 0}};
+    for (int round = 0; round < 3; ++round) {
+        g.loadGraph(connected);
+        CHECK(ariel::IsConnected::Execute(g, workspace));
+        CHECK(ariel::DetectCycle::Execute(g, workspace) == "No cycle found");
+        g.loadGraph(split);
+        CHECK_FALSE(ariel::IsConnected::Execute(g, workspace));
+        g.loadGraph(directed);
+        CHECK(ariel::IsConnected::Execute(g, workspace));
+        CHECK(ariel::DetectCycle::Execute(g, workspace) == "Cycle found: 0->1->2->0");
+    }
+
+    // the workspace bfs stops at the destination and still finds the smallest-index shortest path
+    vector<vector<int>> grid = {
+            {0, 1, 1, 0, 0},
+            {1, 0, 0, 1, 0},
+            {1, 0, 0, 1, 0},
+            {0, 1, 1, 0, 1},
+            {0, 0, 0, 1, 0}};
+    g.loadGraph(grid);
+    CHECK(ariel::ShortestPath::Execute(g, 0, 4, ariel::WeightedEngine::AUTO, workspace) ==
+          "Shortest path from 0 to 4 is: 0->1->3->4");
+    CHECK(ariel::ShortestPath::Execute(g, 4, 0, ariel::WeightedEngine::AUTO, workspace) ==
+          "Shortest path from 4 to 0 is: 4->3->1->0");
+    CHECK(ariel::ShortestPath::Execute(g, 2, 2, ariel::WeightedEngine::AUTO, workspace) ==
+          "There is no path from 2 to 2");
+}
+
+TEST_CASE("Bounded local searches")
+{
+    // a path 0-1-2-3-4 with a branch 1-5
+    vector<vector<int>> graph = {
+            {0, 1, 0, 0, 0, 0},
+            {1, 0, 1, 0, 0, 1},
+            {0, 1, 0, 1, 0, 0},
+            {0, 0, 1, 0, 1, 0},
+            {0, 0, 0, 1, 0, 0},
+            {0, 1, 0, 0, 0, 0}};
+    ariel::Graph g;
+    g.loadGraph(graph);
+    CHECK(g.neighbors(1) == vector<size_t>({0, 2, 5}));
+
+    using Ball = vector<std::pair<size_t, int>>;
+    CHECK(ariel::Algorithms::verticesWithinHops(g, 0, 0) == Ball({{0, 0}}));
+    CHECK(ariel::Algorithms::verticesWithinHops(g, 0, 2) == Ball({{0, 0}, {1, 1}, {2, 2}, {5, 2}}));
+    CHECK(ariel::Algorithms::verticesWithinHops(g, 4, 10).size() == 6);
+
+    vector<vector<int>> weighted = {
+            {0, 4, 1, 0},
+            {4, 0, 2, 7},
+            {1, 2, 0, 0},
+            {0, 7, 0, 0}};
+    g.loadGraph(weighted);
+    CHECK(ariel::Algorithms::verticesWithinDistance(g, 0, 3) == Ball({{0, 0}, {2, 1}, {1, 3}}));
+    CHECK(ariel::Algorithms::verticesWithinDistance(g, 0, 9) == Ball({{0, 0}, {2, 1}, {1, 3}}));
+    CHECK(ariel::Algorithms::verticesWithinDistance(g, 0, 10).back() == std::make_pair(size_t(3), 10));
+    CHECK(ariel::Algorithms::verticesWithinDistance(g, 0, std::numeric_limits<int>::max()).size() == 4);
+    CHECK(ariel::Algorithms::verticesWithinDistance(g, 0, -1).empty());
+
+    // the ball agrees with a full shortest path run
+    vector<int> full = ariel::ShortestPath::dijkstraDistances(g, 3);
+    Ball ball = ariel::Algorithms::verticesWithinDistance(g, 3, 9);
+    bool agrees = true;
+    for (const std::pair<size_t, int> &entry : ball)
+        agrees = agrees && full[entry.first] == entry.second;
+    size_t inside = 0;
+    for (int d : full)
+        inside += d <= 9 ? 1 : 0;
+    CHECK(agrees);
+    CHECK(ball.size() == inside);
+
+    CHECK_THROWS(ariel::Algorithms::verticesWithinHops(g, 4, 1));
+    vector<vector<int>> negative = {
+            {0, -1},
+            {0, 0}};
+    g.loadGraph(negative);
+    CHECK_THROWS(ariel::Algorithms::verticesWithinDistance(g, 0, 5));
+}
+
+TEST_CASE("Yen's k shortest paths")
+{
+    // C=0 D=1 E=2 F=3 G=4 H=5
+    vector<vector<int>> graph = {
+            {0, 3, 2, 0, 0, 0},
+            {0, 0, 0, 4, 0, 0},
+            {0, 1, 0, 2, 3, 0},
+            {0, 0, 0, 0, 2, 1},
+            {0, 0, 0, 0, 0, 2},
+            {0, 0, 0, 0, 0, 0}};
+    ariel::Graph g;
+    g.loadGraph(graph);
+
+    vector<vector<size_t>> paths = ariel::Algorithms::kShortestPaths(g, 0, 5, 10);
+    CHECK(paths.size() == 7);
+    CHECK(paths[0] == vector<size_t>({0, 2, 3, 5}));
+    CHECK(paths[1] == vector<size_t>({0, 2, 4, 5}));
+    CHECK(paths[2] == vector<size_t>({0, 1, 3, 5}));
+    CHECK(paths[3] == vector<size_t>({0, 2, 1, 3, 5}));
+
+    // weights never decrease and every path is loopless and distinct
+    bool ordered = true, loopless = true;
+    int previous = 0;
+    for (const vector<size_t> &path : paths) {
+        int weight = 0;
+        for (size_t i = 0; i + 1 < path.size(); ++i)
+            weight += g.getEdgeWeight(path[i], path[i + 1]);
+        ordered = ordered && weight >= previous;
+        previous = weight;
+        vector<size_t> sorted = path;
+        std::sort(sorted.begin(), sorted.end());
+        loopless = loopless && std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end();
+    }
+    CHECK(ordered);
+    CHECK(loopless);
+    std::set<vector<size_t>> distinct(paths.begin(), paths.end());
+    CHECK(distinct.size() == paths.size());
+
+    CHECK(ariel::Algorithms::kShortestPaths(g, 0, 5, 1).size() == 1);
+    CHECK(ariel::Algorithms::kShortestPaths(g, 5, 0, 3).empty());
+    CHECK(ariel::Algorithms::kShortestPaths(g, 2, 2, 3).empty());
+    CHECK_THROWS(ariel::Algorithms::kShortestPaths(g, 0, 6, 3));
+
+    // on random graphs the weights are the k smallest among all simple paths, listed by a plain search
+    unsigned seed = 31;
+    bool lightest = true;
+    for (int round = 0; round < 40; ++round) {
+        size_t n = 3 + nextRandom(seed) % 5;
+        vector<vector<int>> matrix = randomMatrix(seed, n, 2, true, 4);
+        g.loadGraph(matrix);
+
+        vector<int> all;
+        vector<bool> onPath(n, false);
+        std::function<void(size_t, int)> extend = [&](size_t u, int weight) {
+            if (u == n - 1) {
+                all.push_back(weight);
+                return;
+            }
+            for (size_t v = 0; v < n; ++v) {
+                if (matrix[u][v] != 0 && !onPath[v]) {
+                    onPath[v] = true;
+                    extend(v, weight + matrix[u][v]);
+                    onPath[v] = false;
+                }
+            }
+        };
+        onPath[0] = true;
+        extend(0, 0);
+        std::sort(all.begin(), all.end());
+
+        vector<vector<size_t>> found = ariel::KShortestPaths::Execute(g, 0, n - 1, 6);
+        lightest = lightest && found.size() == std::min<size_t>(6, all.size());
+        for (size_t i = 0; i < found.size() && lightest; ++i) {
+            int weight = 0;
+            for (size_t j = 0; j + 1 < found[i].size(); ++j)
+                weight += g.getEdgeWeight(found[i][j], found[i][j + 1]);
+            lightest = weight == all[i];
+        }
+    }
+    CHECK(lightest);
+}
+
+TEST_CASE("Graph views")
+{
+    vector<vector<int>> graph = {
+            {0, 2, 0, 0},
+            {0, 0, -3, 0},
+            {4, 0, 0, 1},
+            {0, 0, 0, 0}};
+    ariel::Graph g;
+    g.loadGraph(graph);
+
+    // the reversed view matches the reversed copy edge for edge
+    ariel::Graph reversedCopy = g.getReversedGraph();
+    ariel::ReversedView<ariel::Graph> reversed(g);
+    bool sameEdges = reversed.V() == reversedCopy.V();
+    for (size_t u = 0; u < g.V(); ++u)
+        for (size_t v = 0; v < g.V(); ++v)
+            sameEdges = sameEdges && reversed.getEdgeWeight(u, v) == reversedCopy.getEdgeWeight(u, v);
+    CHECK(sameEdges);
+    vector<size_t> into2;
+    reversed.forEachNeighbor(2, [&](size_t v, int) { into2.push_back(v); });
+    CHECK(into2 == vector<size_t>({1}));
+
+    // the super-source view matches addVertexWithEdges
+    ariel::Graph extended = g.addVertexWithEdges();
+    ariel::SuperSourceView<ariel::Graph> withSource(g, MAX_WEIGHT);
+    sameEdges = withSource.V() == extended.V() && withSource.source() == 4;
+    for (size_t u = 0; u < extended.V(); ++u)
+        for (size_t v = 0; v < extended.V(); ++v)
+            sameEdges = sameEdges && withSource.getEdgeWeight(u, v) == extended.getEdgeWeight(u, v);
+    CHECK(sameEdges);
+
+    // vertex masks and edge filters hide edges without touching the graph
+    vector<bool> keep = {true, true, false, true};
+    auto masked = ariel::vertexMaskView(g, keep);
+    CHECK(masked.getEdgeWeight(0, 1) == 2);
+    CHECK(masked.getEdgeWeight(1, 2) == 0);
+    CHECK(masked.getEdgeWeight(2, 3) == 0);
+    auto positive = ariel::edgeFilterView(g, [](size_t, size_t, int w) { return w > 0; });
+    CHECK(positive.getEdgeWeight(1, 2) == 0);
+    CHECK(positive.getEdgeWeight(2, 0) == 4);
+    vector<size_t> from1;
+    positive.forEachNeighbor(1, [&](size_t v, int) { from1.push_back(v); });
+    CHECK(from1.empty());
+    // views compose
+    auto reversedPositive = ariel::reversedView(positive);
+    CHECK(reversedPositive.getEdgeWeight(0, 2) == 4);
+    CHECK(reversedPositive.getEdgeWeight(2, 1) == 0);
+    CHECK(g.getEdgeWeight(1, 2) == -3);
+
+    // the algorithms that use views internally keep their answers
+    CHECK_FALSE(ariel::Algorithms::isConnected(g));
+    vector<vector<int>> strongly = {
+            {0, 1, 0},
+            {0, 0, 1},
+            {1, 0, 0}};
+    g.loadGraph(strongly);
+    CHECK(ariel::Algorithms::isConnected(g));
+    vector<vector<int>> negative = {
+            {0, 1, 0},
+            {0, 0, -5},
+            {2, 0, 0}};
+    g.loadGraph(negative);
+    CHECK(ariel::Algorithms::negativeCycle(g) == "Negative cycle found: 0 -> 1 -> 2 -> 0");
+}
+
+TEST_CASE("Negative cycles by subtree disassembly")
+{
+    // the engine agrees with Floyd-Warshall on random directed graphs and only reports real negative cycles
+    unsigned seed = 12345;
+    bool agrees = true, valid = true;
+    for (int round = 0; round < 60; ++round) {
+        size_t n = 3 + nextRandom(seed) % 8;
+        vector<vector<int>> matrix = randomMatrix(seed, n, 3, true, 13, -6);
+        matrix[0][1] = matrix[0][1] == 0 ? 1 : matrix[0][1];
+        ariel::Graph g;
+        g.loadGraph(matrix);
+        if (g.getGraphType() != ariel::GraphType::DIRECTED)
+            continue;
+
+        const long long INF = std::numeric_limits<long long>::max() / 4;
+        vector<vector<long long>> dist(n, vector<long long>(n, INF));
+        for (size_t u = 0; u < n; ++u)
+            for (size_t v = 0; v < n; ++v)
+                if (matrix[u][v] != 0)
+                    dist[u][v] = matrix[u][v];
+        for (size_t k = 0; k < n; ++k)
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = 0; j < n; ++j)
+                    if (dist[i][k] < INF && dist[k][j] < INF)
+                        dist[i][j] = std::min(dist[i][j], dist[i][k] + dist[k][j]);
+        bool expected = false;
+        for (size_t v = 0; v < n; ++v)
+            expected = expected || dist[v][v] < 0;
+
+        vector<size_t> cycle = ariel::DetectNegativeCycle::findCycle(g);
+        agrees = agrees && expected == !cycle.empty();
+        long long weight = 0;
+        for (size_t i = 0; i < cycle.size(); ++i) {
+            int w = g.getEdgeWeight(cycle[i], cycle[(i + 1) % cycle.size()]);
+            valid = valid && w != 0;
+            weight += w;
+        }
+        valid = valid && (cycle.empty() || weight < 0);
+    }
+    CHECK(agrees);
+    CHECK(valid);
+
+    // undirected graphs: one negative edge is not a cycle, a negative triangle is
+    vector<vector<int>> edge = {
+            {0, -4, 0},
+            {-4, 0, 1},
+            {0, 1, 0}};
+    ariel::Graph g;
+    g.loadGraph(edge);
+    CHECK(ariel::Algorithms::negativeCycle(g) == "No negative cycle detected in the graph");
+    vector<vector<int>> triangle = {
+            {0, -4, 1},
+            {-4, 0, 1},
+            {1, 1, 0}};
+    g.loadGraph(triangle);
+    CHECK(ariel::Algorithms::negativeCycle(g) == "Negative cycle found: 0 -> 1 -> 2 -> 0");
+    // both negative edges lead away from 0, the triangle weighs -1
+    vector<vector<int>> apart = {
+            {0, -2, -2},
+            {-2, 0, 3},
+            {-2, 3, 0}};
+    g.loadGraph(apart);
+    CHECK(ariel::DetectNegativeCycle::findCycle(g).size() == 3);
+
+    // random undirected graphs against a search over all simple cycles of at least three vertices
+    for (int round = 0; round < 200; ++round) {
+        size_t n = 3 + nextRandom(seed) % 5;
+        vector<vector<int>> matrix = randomMatrix(seed, n, 2, false, 8, -5);
+        g.loadGraph(matrix);
+
+        bool expected = false;
+        vector<bool> onPath(n, false);
+        std::function<void(size_t, size_t, size_t, long long)> extend =
+                [&](size_t start, size_t u, size_t length, long long weight) {
+            if (length >= 3 && matrix[u][start] != 0 && weight + matrix[u][start] < 0)
+                expected = true;
+            for (size_t v = start + 1; v < n && !expected; ++v) {
+                if (matrix[u][v] != 0 && !onPath[v]) {
+                    onPath[v] = true;
+                    extend(start, v, length + 1, weight + matrix[u][v]);
+                    onPath[v] = false;
+                }
+            }
+        };
+        for (size_t start = 0; start < n && !expected; ++start) {
+            onPath[start] = true;
+            extend(start, start, 1, 0);
+            onPath[start] = false;
+        }
+
+        vector<size_t> cycle = ariel::DetectNegativeCycle::findCycle(g);
+        agrees = agrees && expected == !cycle.empty();
+        long long weight = 0;
+        vector<bool> seen(n, false);
+        for (size_t i = 0; i < cycle.size(); ++i) {
+            int w = g.getEdgeWeight(cycle[i], cycle[(i + 1) % cycle.size()]);
+            valid = valid && w != 0 && !seen[cycle[i]];
+            seen[cycle[i]] = true;
+            weight += w;
+        }
+        valid = valid && (cycle.empty() || (cycle.size() >= 3 && weight < 0));
+    }
+    CHECK(agrees);
+    CHECK(valid);
+
+    // the cycle is found through views as well
+    vector<vector<int>> directed = {
+            {0, 3, 0},
+            {0, 0, -2},
+            {-2, 0, 0}};
+    g.loadGraph(directed);
+    CHECK(ariel::DetectNegativeCycle::findCycle(g).size() == 3);
+    CHECK(ariel::DetectNegativeCycle::findCycle(ariel::reversedView(g)).size() == 3);
+    auto withoutNegative = ariel::edgeFilterView(g, [](size_t, size_t, int w) { return w > 0; });
+    CHECK(ariel::DetectNegativeCycle::findCycle(withoutNegative).empty());
+}
+
+TEST_CASE("Minimum mean cycle")
+{
+    // two cycles: 0->1->2->0 of mean 2 and 2->3->2 of mean 1.5
+    vector<vector<int>> graph = {
+            {0, 1, 0, 0},
+            {0, 0, 2, 0},
+            {3, 0, 0, 1},
+            {0, 0, 2, 0}};
+    ariel::Graph g;
+    g.loadGraph(graph);
+    CHECK(ariel::MinimumMeanCycle::howard(g) == vector<size_t>({2, 3}));
+    CHECK(ariel::MinimumMeanCycle::karp(g) == doctest::Approx(1.5));
+    CHECK(ariel::Algorithms::minimumMeanCycle(g) == "Minimum mean cycle found: 2 -> 3 -> 2 (total weight 3 over 2 edges)");
+
+    // Howard agrees with Karp on random graphs with negative weights
+    unsigned seed = 777;
+    bool agrees = true;
+    for (int round = 0; round < 60; ++round) {
+        size_t n = 2 + nextRandom(seed) % 9;
+        g.loadGraph(randomMatrix(seed, n, 3, true, 10, -10, true));
+        vector<size_t> cycle = ariel::MinimumMeanCycle::howard(g);
+        // no policy iterations at all: the cycle comes from Karp's table
+        vector<size_t> fallback = ariel::MinimumMeanCycle::howard(g, 0);
+        double karp = ariel::MinimumMeanCycle::karp(g);
+        if (cycle.empty())
+            agrees = agrees && karp == std::numeric_limits<double>::infinity() && fallback.empty();
+        else
+            agrees = agrees && std::fabs(ariel::MinimumMeanCycle::mean(g, cycle) - karp) < 1e-9 &&
+                     std::fabs(ariel::MinimumMeanCycle::mean(g, fallback) - karp) < 1e-9;
+    }
+    CHECK(agrees);
+
+    // two policy cycles of mean -1, the self loop at 7 and 1->5->4->3->2->1, with potentials measured from
+    // different vertices once made the policy of 0 switch between 7 and 8 forever
+    vector<vector<int>> tie = {
+            {0, 0, 0, 0, 0, 0, 4, 4, 1},
+            {0, 0, 0, 0, 0, -1, 0, 0, 0},
+            {0, -3, 0, 0, 0, -3, 0, 0, 0},
+            {1, 0, -1, 0, 0, 0, 0, 5, 0},
+            {0, -2, 2, -3, 0, 0, 0, 0, 0},
+            {0, 0, 0, 0, 3, 0, 0, 0, 0},
+            {0, 0, 0, 0, 0, 0, 0, 0, 0},
+            {0, 0, 1, 0, 0, 0, 0, -1, 0},
+            {0, 0, 0, 0, 4, 0, -3, 0, 0}};
+    g.loadGraph(tie);
+    vector<size_t> tieCycle = ariel::MinimumMeanCycle::howard(g, std::numeric_limits<size_t>::max());
+    CHECK(ariel::MinimumMeanCycle::mean(g, tieCycle) == doctest::Approx(-1.0));
+    CHECK(ariel::MinimumMeanCycle::karp(g) == doctest::Approx(-1.0));
+
+    vector<vector<int>> acyclic = {
+            {0, 1, 4},
+            {0, 0, 2},
+            {0, 0, 0}};
+    g.loadGraph(acyclic);
+    CHECK(ariel::MinimumMeanCycle::howard(g).empty());
+    CHECK(ariel::Algorithms::minimumMeanCycle(g) == "No cycle found in the graph");
+}
+
+TEST_CASE("Simple cycle enumeration")
+{
+    // the complete directed graph on 4 vertices has 6 + 8 + 6 = 20 simple cycles
+    vector<vector<int>> complete = {
+            {0, 1, 1, 1},
+            {1, 0, 1, 1},
+            {1, 1, 0, 1},
+            {1, 1, 1, 0}};
+    vector<vector<int>> directedComplete = complete;
+    directedComplete[0][1] = 2; // not symmetric, so the graph is directed
+    ariel::Graph g;
+    g.loadGraph(directedComplete);
+    size_t count = ariel::SimpleCycles::enumerate(g, [](const vector<size_t> &) { return true; });
+    CHECK(count == 20);
+
+    // the callback can stop the stream at any point
+    size_t seen = 0;
+    CHECK(ariel::SimpleCycles::enumerate(g, [&](const vector<size_t> &) { return ++seen < 5; }) == 5);
+    CHECK(ariel::Algorithms::simpleCycles(g, 3).size() == 3);
+
+    // undirected: the 4 triangles and 3 squares of K4, each once
+    g.loadGraph(complete);
+    vector<vector<size_t>> cycles = ariel::Algorithms::simpleCycles(g, 100);
+    CHECK(cycles.size() == 7);
+    CHECK(cycles[0] == vector<size_t>({0, 1, 2}));
+    std::set<vector<size_t>> distinct(cycles.begin(), cycles.end());
+    CHECK(distinct.size() == cycles.size());
+
+    // only the negative cycles
+    vector<vector<int>> mixed = {
+            {0, 1, 0, 0},
+            {0, 0, -5, 0},
+            {2, 0, 0, 1},
+            {0, 0, 4, 0}};
+    g.loadGraph(mixed);
+    CHECK(ariel::Algorithms::simpleCycles(g, 10).size() == 2);
+    CHECK(ariel::Algorithms::simpleCycles(g, 10, true) == vector<vector<size_t>>({{0, 1, 2}}));
+
+    vector<vector<int>> acyclic = {
+            {0, 1, 1},
+            {0, 0, 1},
+            {0, 0, 0}};
+    g.loadGraph(acyclic);
+    CHECK(ariel::Algorithms::simpleCycles(g, 10).empty());
+}
+
+TEST_CASE("Minimum spanning trees")
+{
+    vector<vector<int>> graph = {
+            {0, 4, 0, 0, 0, 0, 0, 8, 0},
+            {4, 0, 8, 0, 0, 0, 0, 11, 0},
+            {0, 8, 0, 7, 0, 4, 0, 0, 2},
+            {0, 0, 7, 0, 9, 14, 0, 0, 0},
+            {0, 0, 0, 9, 0, 10, 0, 0, 0},
+            {0, 0, 4, 14, 10, 0, 2, 0, 0},
+            {0, 0, 0, 0, 0, 2, 0, 1, 6},
+            {8, 11, 0, 0, 0, 0, 1, 0, 7},
+            {0, 0, 2, 0, 0, 0, 6, 7, 0}};
+    ariel::Graph g;
+    g.loadGraph(graph);
+    using MST = ariel::MinimumSpanningTree;
+    vector<MST::Edge> prim = MST::Execute(g, ariel::MstEngine::PRIM);
+    CHECK(prim.size() == 8);
+    CHECK(MST::totalWeight(prim) == 37);
+    CHECK(ariel::Algorithms::minimumSpanningTree(g) ==
+          "Minimum spanning forest of weight 37: (0,1) (0,7) (2,3) (2,5) (2,8) (3,4) (5,6) (6,7)");
+
+    // every engine returns the same forest, also with ties, negative weights and several components
+    unsigned seed = 4242;
+    bool same = true;
+    for (int round = 0; round < 30; ++round) {
+        size_t n = 2 + nextRandom(seed) % 12;
+        g.loadGraph(randomMatrix(seed, n, 3, false, 4, -2));
+        vector<MST::Edge> a = MST::Execute(g, ariel::MstEngine::PRIM);
+        vector<MST::Edge> b = MST::Execute(g, ariel::MstEngine::KRUSKAL);
+        vector<MST::Edge> c = MST::Execute(g, ariel::MstEngine::BORUVKA, 4);
+        same = same && a.size() == b.size() && a.size() == c.size();
+        for (size_t i = 0; same && i < a.size(); ++i)
+            same = a[i].u == b[i].u && a[i].v == b[i].v && a[i].u == c[i].u && a[i].v == c[i].v;
+    }
+    CHECK(same);
+
+    // a large sparse path goes through parallel Boruvka
+    size_t n = PARALLEL_THRESHOLD + 2;
+    vector<vector<int>> path(n, vector<int>(n, 0));
+    for (size_t v = 0; v + 1 < n; ++v)
+        path[v][v + 1] = path[v + 1][v] = int(v % 5) + 1;
+    g.loadGraph(path);
+    vector<MST::Edge> large = MST::Execute(g);
+    CHECK(large.size() == n - 1);
+
+    vector<vector<int>> directed = {
+            {0, 1},
+            {0, 0}};
+    g.loadGraph(directed);
+    CHECK_THROWS(MST::Execute(g));
+}
+
+TEST_CASE("Maximum flow and minimum cut")
+{
+    vector<vector<int>> graph = {
+            {0, 16, 13, 0, 0, 0},
+            {0, 0, 10, 12, 0, 0},
+            {0, 4, 0, 0, 14, 0},
+            {0, 0, 9, 0, 0, 20},
+            {0, 0, 0, 7, 0, 4},
+            {0, 0, 0, 0, 0, 0}};
+    ariel::Graph g;
+    g.loadGraph(graph);
+    ariel::MaxFlow network(g);
+    CHECK(network.Execute(0, 5, ariel::FlowEngine::DINIC) == 23);
+    CHECK(network.minCutSide() == vector<size_t>({0, 1, 2, 4}));
+    CHECK(network.Execute(0, 5, ariel::FlowEngine::PUSH_RELABEL) == 23);
+    CHECK(network.flow(3, 5) + network.flow(4, 5) == 23);
+    CHECK(network.minCutSide() == vector<size_t>({0, 1, 2, 4}));
+    CHECK(ariel::Algorithms::maxFlow(g, 0, 5) == "Maximum flow from 0 to 5 is 23, minimum cut: (1,3) (4,3) (4,5)");
+    // the same network answers other queries
+    CHECK(network.Execute(1, 4) == 14);
+    CHECK(network.Execute(5, 0) == 0);
+    CHECK(network.minCutSide() == vector<size_t>({5}));
+
+    // both engines agree, the arcs hold a valid flow and the cut has the capacity of the flow
+    unsigned seed = 777;
+    bool valid = true;
+    for (int round = 0; round < 40; ++round) {
+        size_t n = 2 + nextRandom(seed) % 12;
+        bool undirected = round % 3 == 0;
+        bool unit = round % 4 == 1;
+        vector<vector<int>> matrix = randomMatrix(seed, n, 3, !undirected, unit ? 1 : 20);
+        g.loadGraph(matrix);
+        ariel::MaxFlow flow(g);
+        size_t s = nextRandom(seed) % n, t = (s + 1 + nextRandom(seed) % (n - 1)) % n;
+        long long dinic = flow.Execute(s, t, ariel::FlowEngine::DINIC);
+        long long pushRelabel = flow.Execute(s, t, ariel::FlowEngine::PUSH_RELABEL);
+        valid = valid && dinic == pushRelabel;
+
+        long long cut = 0;
+        for (const std::pair<size_t, size_t> &edge : flow.minCutEdges())
+            cut += matrix[edge.first][edge.second];
+        valid = valid && cut == pushRelabel;
+        for (size_t v = 0; v < n; ++v) {
+            long long balance = 0;
+            for (size_t u = 0; u < n; ++u) {
+                long long uv = flow.flow(u, v), vu = flow.flow(v, u);
+                valid = valid && uv <= matrix[u][v];
+                balance += uv - vu;
+            }
+            if (v == t)
+                valid = valid && balance == pushRelabel;
+            else if (v != s)
+                valid = valid && balance == 0;
+        }
+    }
+    CHECK(valid);
+
+    // a large layered network
+    size_t n = 3000;
+    vector<vector<int>> layers(n, vector<int>(n, 0));
+    for (size_t v = 1; v + 1 < n; ++v) {
+        layers[0][v] = 1 + int(v % 7);
+        layers[v][n - 1] = 1 + int(v % 5);
+        if (v + 1 < n - 1)
+            layers[v][v + 1] = 3;
+    }
+    g.loadGraph(layers);
+    ariel::MaxFlow large(g);
+    long long expected = large.Execute(0, n - 1, ariel::FlowEngine::DINIC);
+    CHECK(large.Execute(0, n - 1, ariel::FlowEngine::PUSH_RELABEL) == expected);
+
+    vector<vector<int>> negative = {
+            {0, -1},
+            {0, 0}};
+    g.loadGraph(negative);
+    CHECK_THROWS(ariel::MaxFlow(g));
+    g.loadGraph(graph);
+    CHECK_THROWS(network.Execute(0, 0));
+    CHECK_THROWS(network.Execute(0, 6));
+}
+
+TEST_CASE("Bipartite matchings")
+{
+    // left {0,1,2,3}, right {4,5,6,7}
+    vector<vector<int>> graph = {
+            {0, 0, 0, 0, 1, 1, 0, 0},
+            {0, 0, 0, 0, 1, 0, 0, 0},
+            {0, 0, 0, 0, 0, 1, 1, 1},
+            {0, 0, 0, 0, 0, 0, 0, 1},
+            {1, 1, 0, 0, 0, 0, 0, 0},
+            {1, 0, 1, 0, 0, 0, 0, 0},
+            {0, 0, 1, 0, 0, 0, 0, 0},
+            {0, 0, 1, 1, 0, 0, 0, 0}};
+    ariel::Graph g;
+    g.loadGraph(graph);
+    using BM = ariel::BipartiteMatching;
+    CHECK(ariel::Algorithms::maximumMatching(g) == "Matching of size 4: (0,5) (1,4) (2,6) (3,7)");
+
+    vector<vector<int>> costs = {
+            {0, 0, 0, 4, 1, 3},
+            {0, 0, 0, 2, 0, 5},
+            {0, 0, 0, 3, 2, 2},
+            {4, 2, 3, 0, 0, 0},
+            {1, 0, 2, 0, 0, 0},
+            {3, 5, 2, 0, 0, 0}};
+    g.loadGraph(costs);
+    BM::Matching assignment = BM::assignment(g);
+    CHECK(BM::totalWeight(g, assignment) == 5);
+    CHECK(ariel::Algorithms::minimumWeightAssignment(g) == "Matching of size 3: (0,4) (1,3) (2,5)");
+
+    // Hopcroft-Karp has the size of the unit max flow, the assignment the weight of an exhaustive search
+    unsigned seed = 2024;
+    bool same = true;
+    for (int round = 0; round < 40; ++round) {
+        size_t left = 1 + nextRandom(seed) % 6, right = 1 + nextRandom(seed) % 6, n = left + right;
+        vector<vector<int>> matrix(n, vector<int>(n, 0));
+        for (size_t u = 0; u < left; ++u)
+            for (size_t v = left; v < n; ++v)
+                if (nextRandom(seed) % 2 == 0) {
+                    int w = int(nextRandom(seed) % 11) - 3;
+                    matrix[u][v] = matrix[v][u] = w == 0 ? 4 : w;
+                }
+        g.loadGraph(matrix);
+        BM::Matching matching = BM::Execute(g);
+        BM::Matching cheapest = BM::assignment(g);
+
+        vector<vector<int>> network(n + 2, vector<int>(n + 2, 0));
+        for (size_t u = 0; u < left; ++u) {
+            network[n][u] = 1;
+            for (size_t v = left; v < n; ++v)
+                network[u][v] = matrix[u][v] != 0 ? 1 : 0;
+        }
+        for (size_t v = left; v < n; ++v)
+            network[v][n + 1] = 1;
+        ariel::Graph flowGraph;
+        flowGraph.loadGraph(network);
+        ariel::MaxFlow flow(flowGraph);
+        same = same && (long long) matching.size() == flow.Execute(n, n + 1);
+        same = same && cheapest.size() == matching.size();
+
+        // exhaustive search for the lightest maximum matching
+        std::pair<size_t, long long> best(0, 0);
+        vector<bool> used(n, false);
+        std::function<void(size_t, size_t, long long)> search = [&](size_t u, size_t size, long long weight) {
+            if (u == left) {
+                if (size > best.first || (size == best.first && weight < best.second))
+                    best = std::make_pair(size, weight);
+                return;
+            }
+            search(u + 1, size, weight);
+            for (size_t v = left; v < n; ++v)
+                if (matrix[u][v] != 0 && !used[v]) {
+                    used[v] = true;
+                    search(u + 1, size + 1, weight + matrix[u][v]);
+                    used[v] = false;
+                }
+        };
+        search(0, 0, 0);
+        same = same && best.first == cheapest.size() && best.second == BM::totalWeight(g, cheapest);
+    }
+    CHECK(same);
+
+    // a large sparse bipartite graph, every left vertex has a right partner
+    size_t n = 2 * (PARALLEL_THRESHOLD + 2);
+    vector<vector<int>> large(n, vector<int>(n, 0));
+    for (size_t u = 0; u < n; u += 2) {
+        large[u][u + 1] = large[u + 1][u] = 1;
+        if (u + 3 < n)
+            large[u][u + 3] = large[u + 3][u] = 1;
+    }
+    g.loadGraph(large);
+    CHECK(BM::Execute(g).size() == n / 2);
+
+    vector<vector<int>> triangle = {
+            {0, 1, 1},
+            {1, 0, 1},
+            {1, 1, 0}};
+    g.loadGraph(triangle);
+    CHECK_THROWS((void) BM::Execute(g));
+    vector<vector<int>> directed = {
+            {0, 1},
+            {0, 0}};
+    g.loadGraph(directed);
+    CHECK_THROWS((void) BM::assignment(g));
+}
+
+TEST_CASE("Incremental bipartiteness")
+{
+    ariel::IncrementalBipartite stream(5);
+    CHECK(stream.addEdge(0, 1));
+    CHECK(stream.addEdge(1, 2));
+    CHECK(stream.addEdge(3, 4));
+    CHECK(stream.addEdge(2, 3));
+    CHECK(stream.side(0) != stream.side(1));
+    CHECK(stream.side(0) == stream.side(4));
+    CHECK(stream.connected(0, 4));
+    CHECK(stream.oddCycle().empty());
+    CHECK(stream.toString() == "Graph is bipartite");
+    // 1 - 2 - 3 - 4 closed by 4 - 1 is even
+    CHECK(stream.addEdge(4, 1));
+    // 0 - 1 - 2 - 3 - 4 closed by 0 - 4 is odd
+    CHECK_FALSE(stream.addEdge(4, 0));
+    CHECK(stream.toString() == "Odd cycle found: 0 -> 4 -> 3 -> 2 -> 1 -> 0");
+    size_t v = stream.addVertex();
+    CHECK(v == 5);
+    CHECK_FALSE(stream.addEdge(5, 0));
+    CHECK(stream.connected(5, 2));
+
+    vector<vector<int>> graph = {
+            {0, 1, 0, 0, 1},
+            {1, 0, 1, 0, 0},
+            {0, 1, 0, 1, 0},
+            {0, 0, 1, 0, 1},
+            {1, 0, 0, 1, 0}};
+    ariel::Graph g;
+    g.loadGraph(graph);
+    CHECK(ariel::Algorithms::oddCycle(g) == "Odd cycle found: 0 -> 4 -> 3 -> 2 -> 1 -> 0");
+
+    // agrees with IsBipartite, and every certificate is an odd cycle of the graph
+    unsigned seed = 31337;
+    bool same = true;
+    for (int round = 0; round < 60; ++round) {
+        size_t n = 2 + nextRandom(seed) % 12;
+        vector<vector<int>> matrix = randomMatrix(seed, n, 4, false, 1);
+        g.loadGraph(matrix);
+        ariel::IncrementalBipartite check(g);
+        same = same && check.isBipartite() == (ariel::Algorithms::isBipartite(g) != "Graph is not bipartite");
+        const vector<size_t> &cycle = check.oddCycle();
+        if (!cycle.empty()) {
+            same = same && cycle.size() % 2 == 1 && std::set<size_t>(cycle.begin(), cycle.end()).size() == cycle.size();
+            for (size_t i = 0; i < cycle.size(); ++i)
+                same = same && matrix[cycle[i]][cycle[(i + 1) % cycle.size()]] != 0;
+        }
+    }
+    CHECK(same);
+
+    CHECK_THROWS((void) stream.addEdge(0, 9));
+}
+
+TEST_CASE("Triangles and clustering coefficients")
+{
+    // two triangles sharing the edge 1-2, and a pendant vertex 4
+    vector<vector<int>> graph = {
+            {0, 1, 1, 0, 0},
+            {1, 0, 1, 1, 0},
+            {1, 1, 0, 1, 0},
+            {0, 1, 1, 0, 1},
+            {0, 0, 0, 1, 0}};
+    ariel::Graph g;
+    g.loadGraph(graph);
+    CHECK(ariel::Algorithms::countTriangles(g) == 2);
+    CHECK(ariel::TriangleCount::perVertex(g, ariel::TriangleEngine::BITSET) == vector<size_t>({1, 2, 2, 1, 0}));
+    CHECK(ariel::TriangleCount::perVertex(g, ariel::TriangleEngine::MERGE) == vector<size_t>({1, 2, 2, 1, 0}));
+    vector<double> coefficients = ariel::Algorithms::clusteringCoefficients(g);
+    CHECK(coefficients[0] == doctest::Approx(1.0));
+    CHECK(coefficients[1] == doctest::Approx(2.0 / 3.0));
+    CHECK(coefficients[3] == doctest::Approx(1.0 / 3.0));
+    CHECK(coefficients[4] == doctest::Approx(0.0));
+    // 2 triangles over 1 + 3 + 3 + 3 paths of length two
+    CHECK(ariel::TriangleCount::transitivity(g) == doctest::Approx(0.6));
+
+    // both kernels agree with a count over all vertex triples, also with self loops and weights
+    unsigned seed = 99;
+    bool same = true;
+    for (int round = 0; round < 30; ++round) {
+        size_t n = 1 + nextRandom(seed) % 20;
+        vector<vector<int>> matrix = randomMatrix(seed, n, 3, false, 5, 1, true);
+        g.loadGraph(matrix);
+        vector<size_t> expected(n, 0);
+        for (size_t a = 0; a < n; ++a)
+            for (size_t b = a + 1; b < n; ++b)
+                for (size_t c = b + 1; c < n; ++c)
+                    if (matrix[a][b] != 0 && matrix[b][c] != 0 && matrix[a][c] != 0) {
+                        expected[a]++;
+                        expected[b]++;
+                        expected[c]++;
+                    }
+        same = same && ariel::TriangleCount::perVertex(g, ariel::TriangleEngine::BITSET) == expected;
+        same = same && ariel::TriangleCount::perVertex(g, ariel::TriangleEngine::MERGE) == expected;
+    }
+    CHECK(same);
+
+    // a large graph runs on the threads, a wheel has one triangle per rim edge
+    size_t n = PARALLEL_THRESHOLD + 10;
+    vector<vector<int>> wheel(n, vector<int>(n, 0));
+    for (size_t v = 1; v < n; ++v) {
+        wheel[0][v] = wheel[v][0] = 1;
+        size_t next = v + 1 < n ? v + 1 : 1;
+        wheel[v][next] = wheel[next][v] = 1;
+    }
+    g.loadGraph(wheel);
+    CHECK(ariel::TriangleCount::Execute(g, ariel::TriangleEngine::MERGE, 4) == n - 1);
+    CHECK(ariel::TriangleCount::Execute(g, ariel::TriangleEngine::BITSET, 4) == n - 1);
+
+    vector<vector<int>> directed = {
+            {0, 1},
+            {0, 0}};
+    g.loadGraph(directed);
+    CHECK_THROWS((void) ariel::TriangleCount::Execute(g));
+}
+
+TEST_CASE("PageRank")
+{
+    vector<vector<int>> graph = {
+            {0, 1, 1, 0},
+            {0, 0, 1, 0},
+            {1, 0, 0, 0},
+            {0, 0, 1, 0}};
+    ariel::Graph g;
+    g.loadGraph(graph);
+    CHECK(g * vector<double>({1, 2, 3, 4}) == vector<double>({5, 3, 1, 3}));
+    CHECK_THROWS((void) (g * vector<double>({1, 2})));
+    // the transposed product reads the columns in place, as the reversed graph's rows
+    CHECK(g.transposeMultiply(vector<double>({1, 2, 3, 4})) == vector<double>({3, 1, 7, 0}));
+    CHECK(g.transposeMultiply(vector<float>({1, 2, 3, 4})) == g.getReversedGraph() * vector<float>({1, 2, 3, 4}));
+    CHECK_THROWS((void) g.transposeMultiply(vector<double>({1, 2})));
+
+    // reference ranks of the fully converged power iteration
+    vector<double> rank = ariel::Algorithms::pageRank(g);
+    double sum = 0;
+    for (double r : rank)
+        sum += r;
+    CHECK(sum == doctest::Approx(1.0));
+    CHECK(rank[0] == doctest::Approx(0.372526).epsilon(1e-4));
+    CHECK(rank[1] == doctest::Approx(0.195824).epsilon(1e-4));
+    CHECK(rank[2] == doctest::Approx(0.394149).epsilon(1e-4));
+    CHECK(rank[3] == doctest::Approx(0.0375).epsilon(1e-4));
+    vector<float> single = ariel::PageRank::Execute<float>(g);
+    CHECK(single[2] == doctest::Approx(0.394149).epsilon(1e-3));
+
+    // a symmetric cycle ranks every vertex the same, a personalized rank prefers the seed
+    vector<vector<int>> cycle = {
+            {0, 1, 0, 1},
+            {1, 0, 1, 0},
+            {0, 1, 0, 1},
+            {1, 0, 1, 0}};
+    g.loadGraph(cycle);
+    rank = ariel::Algorithms::pageRank(g);
+    CHECK(rank[0] == doctest::Approx(0.25));
+    CHECK(rank[3] == doctest::Approx(0.25));
+    rank = ariel::Algorithms::personalizedPageRank(g, {0});
+    CHECK(rank[0] > rank[1]);
+    CHECK(rank[1] == doctest::Approx(rank[3]));
+    CHECK(rank[1] > rank[2]);
+
+    // dangling vertices and a large graph on the threads, the ranks still sum to 1
+    size_t n = PARALLEL_THRESHOLD + 5;
+    vector<vector<int>> chain(n, vector<int>(n, 0));
+    for (size_t v = 0; v + 1 < n; ++v)
+        chain[v][v + 1] = 1 + int(v % 3);
+    g.loadGraph(chain);
+    rank = ariel::PageRank::Execute(g, 0.85, 1e-9, 1000);
+    sum = 0;
+    bool increasing = true;
+    for (size_t v = 0; v < n; ++v) {
+        sum += rank[v];
+        if (v > 0 && v < 20)
+            increasing = increasing && rank[v] > rank[v - 1];
+    }
+    CHECK(sum == doctest::Approx(1.0));
+    CHECK(increasing);
+
+    CHECK_THROWS((void) ariel::Algorithms::personalizedPageRank(g, {}));
+    CHECK_THROWS((void) ariel::Algorithms::personalizedPageRank(g, {n}));
+    vector<vector<int>> negative = {
+            {0, -1},
+            {1, 0}};
+    g.loadGraph(negative);
+    CHECK_THROWS((void) ariel::Algorithms::pageRank(g));
+}
+
+TEST_CASE("Betweenness centrality")
+{
+    // a path counts the pairs on either side of every inner vertex
+    vector<vector<int>> path = {
+            {0, 1, 0, 0, 0},
+            {1, 0, 1, 0, 0},
+            {0, 1, 0, 1, 0},
+            {0, 0, 1, 0, 1},
+            {0, 0, 0, 1, 0}};
+    ariel::Graph g;
+    g.loadGraph(path);
+    CHECK(ariel::Algorithms::betweenness(g) == vector<double>({0, 3, 4, 3, 0}));
+
+    // two equal routes around a square split the pair between them
+    vector<vector<int>> square = {
+            {0, 2, 0, 1},
+            {2, 0, 1, 0},
+            {0, 1, 0, 2},
+            {1, 0, 2, 0}};
+    g.loadGraph(square);
+    vector<double> scores = ariel::Algorithms::betweenness(g);
+    CHECK(scores[0] == doctest::Approx(0.5));
+    CHECK(scores[1] == doctest::Approx(0.5));
+    CHECK(scores[3] == doctest::Approx(0.5));
+
+    // random weighted and unweighted graphs against the definition over all pairs, by Floyd-Warshall distances
+    // and path counts taken in increasing distance
+    unsigned seed = 7;
+    for (int round = 0; round < 40; ++round) {
+        size_t n = 3 + nextRandom(seed) % 8;
+        bool directed = round % 2 == 1;
+        bool weighted = round % 4 >= 2;
+        vector<vector<int>> matrix = randomMatrix(seed, n, 3, directed, weighted ? 3 : 1);
+        g.loadGraph(matrix);
+
+        const long long INF = 1LL << 40;
+        vector<vector<long long>> d(n, vector<long long>(n, INF));
+        for (size_t u = 0; u < n; ++u) {
+            d[u][u] = 0;
+            for (size_t v = 0; v < n; ++v) {
+                if (matrix[u][v] != 0)
+                    d[u][v] = std::min(d[u][v], (long long) matrix[u][v]);
+            }
+        }
+        for (size_t k = 0; k < n; ++k)
+            for (size_t u = 0; u < n; ++u)
+                for (size_t v = 0; v < n; ++v)
+                    d[u][v] = std::min(d[u][v], d[u][k] + d[k][v]);
+        vector<vector<double>> count(n, vector<double>(n, 0));
+        for (size_t s = 0; s < n; ++s) {
+            vector<size_t> order(n);
+            for (size_t v = 0; v < n; ++v)
+                order[v] = v;
+            std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return d[s][a] < d[s][b]; });
+            count[s][s] = 1;
+            for (size_t t : order) {
+                for (size_t u = 0; u < n && t != s && d[s][t] < INF; ++u) {
+                    if (matrix[u][t] != 0 && d[s][u] + matrix[u][t] == d[s][t])
+                        count[s][t] += count[s][u];
+                }
+            }
+        }
+        vector<double> expected(n, 0);
+        for (size_t s = 0; s < n; ++s)
+            for (size_t t = 0; t < n; ++t)
+                for (size_t v = 0; v < n; ++v)
+                    if (s != t && v != s && v != t && d[s][t] < INF && d[s][v] + d[v][t] == d[s][t])
+                        expected[v] += count[s][v] * count[v][t] / count[s][t];
+        if (!directed) {
+            for (double &score : expected)
+                score /= 2;
+        }
+
+        vector<double> single = ariel::Betweenness::Execute(g, 1);
+        vector<double> threaded = ariel::Betweenness::Execute(g, 4);
+        for (size_t v = 0; v < n; ++v) {
+            CHECK(single[v] == doctest::Approx(expected[v]));
+            CHECK(threaded[v] == doctest::Approx(expected[v]));
+        }
+    }
+
+    // every source of a cycle adds the same total, so any sample estimates the total exactly
+    size_t n = 200;
+    vector<vector<int>> cycle(n, vector<int>(n, 0));
+    for (size_t v = 0; v < n; ++v) {
+        cycle[v][(v + 1) % n] = 1;
+        cycle[(v + 1) % n][v] = 1;
+    }
+    g.loadGraph(cycle);
+    vector<double> exact = ariel::Algorithms::betweenness(g);
+    vector<double> estimate = ariel::Algorithms::betweenness(g, 20);
+    double exactSum = 0, estimateSum = 0;
+    for (size_t v = 0; v < n; ++v) {
+        CHECK(exact[v] == doctest::Approx(exact[0]));
+        exactSum += exact[v];
+        estimateSum += estimate[v];
+    }
+    CHECK(estimateSum == doctest::Approx(exactSum));
+    CHECK(ariel::Betweenness::sampled(g, 20, 5) == ariel::Betweenness::sampled(g, 20, 5));
+    CHECK(ariel::Algorithms::betweenness(g, n) == exact);
+
+    vector<vector<int>> negative = {
+            {0, -1},
+            {-1, 0}};
+    g.loadGraph(negative);
+    CHECK_THROWS((void) ariel::Algorithms::betweenness(g));
+}
+
+TEST_CASE("Core decomposition and degeneracy ordering")
+{
+    // a triangle with a tail and a self loop, which no degree counts
+    vector<vector<int>> graph = {
+            {0, 1, 1, 0, 0},
+            {1, 0, 1, 0, 0},
+            {1, 1, 0, 1, 0},
+            {0, 0, 1, 0, 1},
+            {0, 0, 0, 1, 1}};
+    ariel::Graph g;
+    g.loadGraph(graph);
+    CHECK(g.degree(2) == 3);
+    CHECK(g.degree(4) == 1);
+    CHECK(g.outDegree(4) == 2);
+    CHECK(g.inDegree(4) == 2);
+    CHECK(ariel::Algorithms::coreNumbers(g) == vector<size_t>({2, 2, 2, 1, 1}));
+    CHECK(ariel::KCore::degeneracy(g) == 2);
+    CHECK(ariel::Algorithms::degeneracyOrdering(g).size() == 5);
+
+    vector<vector<int>> directed = {
+            {0, 1, 1},
+            {0, 0, 1},
+            {0, 0, 0}};
+    g.loadGraph(directed);
+    CHECK(g.degree(0) == 2);
+    CHECK(g.inDegree(2) == 2);
+    CHECK(g.degree(2) == 2);
+    CHECK_THROWS((void) ariel::Algorithms::coreNumbers(g));
+
+    // both engines against peeling the smallest degree one vertex at a time, on small graphs and on one large
+    // enough for the threads
+    unsigned seed = 11;
+    for (int round = 0; round < 21; ++round) {
+        size_t n = round == 20 ? PARALLEL_THRESHOLD + 50 : 2 + nextRandom(seed) % 30;
+        unsigned density = round == 20 ? 400 : 2 + nextRandom(seed) % 5;
+        g.loadGraph(randomMatrix(seed, n, density, false, 4));
+
+        vector<size_t> expected(n, 0), degree(n);
+        vector<bool> removed(n, false);
+        for (size_t v = 0; v < n; ++v)
+            degree[v] = g.degree(v);
+        size_t k = 0;
+        for (size_t step = 0; step < n; ++step) {
+            size_t best = n;
+            for (size_t v = 0; v < n; ++v) {
+                if (!removed[v] && (best == n || degree[v] < degree[best]))
+                    best = v;
+            }
+            k = std::max(k, degree[best]);
+            expected[best] = k;
+            removed[best] = true;
+            for (size_t v : g.neighbors(best)) {
+                if (!removed[v])
+                    degree[v]--;
+            }
+        }
+
+        for (ariel::CoreEngine engine : {ariel::CoreEngine::BUCKET, ariel::CoreEngine::PARALLEL}) {
+            CHECK(ariel::KCore::Execute(g, engine, 4) == expected);
+
+            // every vertex has at most its core number of neighbours later in the ordering
+            vector<size_t> order = ariel::KCore::degeneracyOrdering(g, engine, 4);
+            vector<size_t> rank(n, n);
+            for (size_t i = 0; i < order.size(); ++i)
+                rank[order[i]] = i;
+            bool permutation = order.size() == n, bounded = true;
+            for (size_t v = 0; v < n; ++v) {
+                permutation = permutation && rank[v] < n;
+                size_t later = 0;
+                for (size_t u : g.neighbors(v))
+                    later += rank[u] > rank[v] ? 1u : 0u;
+                bounded = bounded && later <= expected[v];
+            }
+            CHECK(permutation);
+            CHECK(bounded);
+        }
+    }
+}
@@ -0,0 +1,141 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "TriangleCount.hpp"
+#include "Bitmap.hpp"
+#include <stdexcept>
+
+namespace ariel {
+
+    /**
+     * Counts the triangles through every vertex.
+     * a dense graph is handled with bit rows, where one AND of two rows covers 64 candidate vertices per word and
+     * costs V / 64 words, and a sparse graph with merges of sorted lists that cost about the degrees. the bit rows
+     * are used once the average degree reaches V / 64. large graphs spread the vertices over the threads.
+     * @param g The undirected graph.
+     * @param engine The kernel to use, AUTO chooses by density.
+     * @param threads Number of worker threads for graphs above PARALLEL_THRESHOLD vertices.
+     * @return The number of triangles every vertex belongs to.
+     * @throws std::invalid_argument if the graph is directed.
+     */
+    std::vector<size_t> TriangleCount::perVertex(const Graph &g, TriangleEngine engine, size_t threads) {
+        checkInput(g);
+        if (g.V() <= PARALLEL_THRESHOLD || threads == 0)
+            threads = 1;
+        if (engine == TriangleEngine::AUTO)
+            engine = g.E() * 64 >= g.V() * g.V() ? TriangleEngine::BITSET : TriangleEngine::MERGE;
+        return engine == TriangleEngine::BITSET ? bitset(g, threads) : merge(g, threads);
+    }
+
+    size_t TriangleCount::Execute(const Graph &g, TriangleEngine engine, size_t threads) {
+        size_t total = 0;
+        for (size_t count : perVertex(g, engine, threads))
+            total += count;
+        // every triangle was counted at its three vertices
+        return total / 3;
+    }
+
+    std::vector<double> TriangleCount::clusteringCoefficients(const Graph &g) {
+        std::vector<size_t> triangles = perVertex(g);
+        std::vector<double> coefficients(g.V(), 0.0);
+        for (size_t v = 0; v < g.V(); ++v) {
+            size_t d = g.degree(v);
+            if (d >= 2)
+                coefficients[v] = 2.0 * static_cast<double>(triangles[v]) / static_cast<double>(d * (d - 1));
+        }
+        return coefficients;
+    }
+
+    double TriangleCount::transitivity(const Graph &g) {
+        size_t triangles = Execute(g);
+        size_t paths = 0;
+        for (size_t v = 0; v < g.V(); ++v) {
+            size_t d = g.degree(v);
+            paths += d * (d - 1) / 2;
+        }
+        return paths == 0 ? 0.0 : 3.0 * static_cast<double>(triangles) / static_cast<double>(paths);
+    }
+
+    /**
+     * Every triangle through u is seen twice among the common neighbours of u and its neighbours,
+     * once from each of its other two vertices, so the row intersections of u sum to twice its count.
+     */
+    std::vector<size_t> TriangleCount::bitset(const Graph &g, size_t threads) {
+        size_t n = g.V();
+        std::vector<Bitmap> rows(n, Bitmap(n));
+        for (size_t u = 0; u < n; ++u) {
+            for (size_t v : g.neighbors(u)) {
+                if (v != u)
+                    rows[u].set(v);
+            }
+        }
+
+        // every worker writes only the counts of its own vertices
+        std::vector<size_t> triangles(n, 0);
+        Parallel::forEach(0, n, threads, [&](size_t, size_t u) {
+            size_t twice = 0;
+            for (size_t v : g.neighbors(u)) {
+                if (v != u)
+                    twice += rows[u].countAnd(rows[v]);
+            }
+            triangles[u] = twice / 2;
+        }, 16);
+        return triangles;
+    }
+
+    /**
+     * Every edge is kept in the direction of the endpoint with the higher (degree, index), so a vertex keeps at
+     * most O(sqrt(E)) out-neighbours and every triangle is found exactly once, at its lowest vertex, by merging
+     * the out-lists of an edge. the counts of a triangle's three vertices go to per-thread arrays that are summed
+     * at the end, so the workers need no atomics.
+     */
+    std::vector<size_t> TriangleCount::merge(const Graph &g, size_t threads) {
+        size_t n = g.V();
+        auto before = [&](size_t a, size_t b) {
+            return g.degree(a) != g.degree(b) ? g.degree(a) < g.degree(b) : a < b;
+        };
+
+        // the out-lists keep the increasing order of the adjacency lists
+        std::vector<std::vector<size_t>> out(n);
+        for (size_t u = 0; u < n; ++u) {
+            for (size_t v : g.neighbors(u)) {
+                if (v != u && before(u, v))
+                    out[u].push_back(v);
+            }
+        }
+
+        std::vector<std::vector<size_t>> partial(threads, std::vector<size_t>(n, 0));
+        Parallel::forEach(0, n, threads, [&](size_t thread, size_t u) {
+            std::vector<size_t> &counts = partial[thread];
+            const std::vector<size_t> &outU = out[u];
+            for (size_t v : outU) {
+                const std::vector<size_t> &outV = out[v];
+                size_t i = 0, j = 0;
+                while (i < outU.size() && j < outV.size()) {
+                    if (outU[i] < outV[j]) {
+                        ++i;
+                    } else if (outV[j] < outU[i]) {
+                        ++j;
+                    } else {
+                        counts[u]++;
+                        counts[v]++;
+                        counts[outU[i]]++;
+                        ++i;
+                        ++j;
+                    }
+                }
+            }
+        });
+
+        std::vector<size_t> triangles(n, 0);
+        for (const std::vector<size_t> &counts : partial) {
+            for (size_t v = 0; v < n; ++v)
+                triangles[v] += counts[v];
+        }
+        return triangles;
+    }
+
+    void TriangleCount::checkInput(const Graph &g) {
+        if (g.getGraphType() == GraphType::DIRECTED)
+            throw std::invalid_argument("Triangle counting requires an undirected graph");
+    }
+}
@@ -0,0 +1,40 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef TRIANGLE_COUNT_HPP
+#define TRIANGLE_COUNT_HPP
+
+#include "Graph.hpp"
+#include "Parallel.hpp"
+#include <vector>
+
+namespace ariel {
+    // intersection kernel of the triangle counts, AUTO picks one from the density of the graph
+    enum class TriangleEngine { AUTO, BITSET, MERGE };
+
+    /**
+     * Triangles and clustering coefficients of an undirected graph, self loops are ignored.
+     */
+    class TriangleCount {
+    public:
+        // number of triangles through every vertex
+        static std::vector<size_t> perVertex(const Graph &g, TriangleEngine engine = TriangleEngine::AUTO,
+                                             size_t threads = Parallel::numThreads());
+        // number of triangles of the graph
+        static size_t Execute(const Graph &g, TriangleEngine engine = TriangleEngine::AUTO,
+                              size_t threads = Parallel::numThreads());
+        // fraction of the pairs of neighbours of every vertex that are adjacent, 0 below two neighbours
+        static std::vector<double> clusteringCoefficients(const Graph &g);
+        // fraction of the paths of length two that are closed into triangles
+        static double transitivity(const Graph &g);
+
+    private:
+        // adjacency bit rows ANDed and counted for every edge, O(E * V / 64) words
+        static std::vector<size_t> bitset(const Graph &g, size_t threads);
+        // edges oriented from lower to higher degree, sorted out-lists merged, O(E * sqrt(E))
+        static std::vector<size_t> merge(const Graph &g, size_t threads);
+
+        static void checkInput(const Graph &g);
+    };
+}
+
+#endif // TRIANGLE_COUNT_HPP
@@ -0,0 +1,13 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#include "Workspace.hpp"
+
+namespace ariel {
+
+    Workspace::Workspace() : heap(0, 0), dial(0, 0) {}
+
+    Workspace &Workspace::local() {
+        thread_local Workspace workspace;
+        return workspace;
+    }
+}
@@ -0,0 +1,123 @@
+//written by Ido Avraham : 208699181
+//EMAIL: idoavraham086@gmail.com
+#ifndef WORKSPACE_HPP
+#define WORKSPACE_HPP
+
+#include "PriorityQueues.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+namespace ariel {
+
+    /**
+     * An array whose entries can all be reset to one value in O(1).
+     * every entry carries the epoch it was last written in, entries from older epochs read as the fill value.
+     * the storage only grows, so reusing the array across calls allocates nothing.
+     */
+    template <typename T>
+    class StampedArray {
+    public:
+        StampedArray() : length(0), epoch(0), fill() {}
+
+        // makes the first n entries equal to value
+        void reset(size_t n, const T &value) {
+            if (n > values.size()) {
+                values.resize(n);
+                stamps.resize(n, 0);
+            }
+            length = n;
+            fill = value;
+            // on wrap around the old stamps could look current again, so they are cleared once
+            if (++epoch == 0) {
+                std::fill(stamps.begin(), stamps.end(), 0);
+                epoch = 1;
+            }
+        }
+
+        size_t size() const { return length; }
+
+        // read only access, safe to use from several threads
+        T operator[](size_t i) const { return stamps[i] == epoch ? values[i] : fill; }
+
+        T &operator[](size_t i) {
+            if (stamps[i] != epoch) {
+                stamps[i] = epoch;
+                values[i] = fill;
+            }
+            return values[i];
+        }
+
+    private:
+        size_t length;
+        uint32_t epoch;
+        T fill;
+        std::vector<T> values;
+        std::vector<uint32_t> stamps;
+    };
+
+    /**
+     * A set of visited vertices for graph traversals, cleared in O(1).
+     * a vertex is in the set when its stamp equals the current generation, clear() starts a new generation,
+     * so a traversal only pays for the vertices it actually visits.
+     */
+    class VisitedSet {
+    public:
+        VisitedSet() : length(0), generation(0) {}
+
+        // empties the set and makes room for the vertices 0..n-1
+        void clear(size_t n) {
+            if (n > stamps.size())
+                stamps.resize(n, 0);
+            length = n;
+            if (++generation == 0) {
+                std::fill(stamps.begin(), stamps.end(), 0);
+                generation = 1;
+            }
+        }
+
+        size_t size() const { return length; }
+
+        bool contains(size_t v) const { return stamps[v] == generation; }
+
+        // adds v, returns false if it was visited already
+        bool insert(size_t v) {
+            if (stamps[v] == generation)
+                return false;
+            stamps[v] = generation;
+            return true;
+        }
+
+    private:
+        size_t length;
+        uint32_t generation;
+        std::vector<uint32_t> stamps;
+    };
+
+    /**
+     * Scratch buffers the algorithms reuse between calls instead of allocating them per call.
+     * callers may keep their own workspace, otherwise every thread has a cached one in Workspace::local().
+     * a workspace must not be used by two algorithms at the same time.
+     */
+    class Workspace {
+    public:
+        Workspace();
+
+        // the workspace cached for the calling thread
+        static Workspace &local();
+
+        StampedArray<int> dist;
+        StampedArray<size_t> predecessors;
+        StampedArray<int> colors;
+        VisitedSet visited;
+        // a second set, for searches that mask vertices or edges out while they track what they visited
+        VisitedSet mask;
+        // FIFO queue (or DFS stack) of vertices, a queue is read from an index instead of popping so the storage is kept
+        std::vector<size_t> queue;
+        IndexedDaryHeap<4> heap;
+        DialQueue dial;
+    };
+}
+
+#endif // WORKSPACE_HPP